@@ -0,0 +1,229 @@
+#include "absorption.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* private functions =================================================== */
+
+/**
+ * @brief One Gauss-Seidel update of a transient state, in place.
+ *
+ * x_i = (sum over j != i of P_ij x_j + b_i) / (1 - P_ii), where the values of
+ * a persistent state j are 1 in its own column and 0 elsewhere, and b_i is 1
+ * for the expected time and 0 for the probabilities.
+ *
+ * @param graph The CSR graph.
+ * @param a Absorption result being computed.
+ * @param state State to update (0-indexed).
+ * @param acc Scratch array of persistent_count entries.
+ * @return Largest relative change of the state's values, -1 if the state cannot leave itself.
+ */
+static double updateTransientState(t_csr_graph graph, t_absorption *a, int state, double *acc) {
+    int m = a->persistent_count;
+    double diag = 0.0, time = 1.0;
+    memset(acc, 0, (size_t)m * sizeof *acc);
+    for (int e = graph.offsets[state]; e < graph.offsets[state + 1]; e++) {
+        int j = graph.targets[e] - 1;
+        double w = graph.weights[e];
+        if (j == state) {
+            diag += w;
+            continue;
+        }
+        int rj = a->row_of_state[j];
+        if (rj < 0) {
+            acc[-1 - rj] += w;
+        } else {
+            time += w * a->expected_steps[j];
+            const double *pj = a->probabilities + (size_t)rj * m;
+            for (int r = 0; r < m; r++) acc[r] += w * pj[r];
+        }
+    }
+    double denom = 1.0 - diag;
+    if (denom <= 0.0) return -1.0;
+
+    double *pi = a->probabilities + (size_t)a->row_of_state[state] * m;
+    double value = time / denom;
+    double change = fabs(value - a->expected_steps[state]) / fmax(1.0, fabs(value));
+    a->expected_steps[state] = value;
+    for (int r = 0; r < m; r++) {
+        value = acc[r] / denom;
+        change = fmax(change, fabs(value - pi[r]));
+        pi[r] = value;
+    }
+    return change;
+}
+
+/**
+ * @brief Solves the absorption values of one transient class by Gauss-Seidel sweeps.
+ *
+ * Every class reached from this one must already be solved.
+ *
+ * @param graph The CSR graph.
+ * @param a Absorption result being computed.
+ * @param c The transient class.
+ * @param tolerance Threshold on the relative change of a sweep.
+ * @param acc Scratch array of persistent_count entries.
+ * @return Number of sweeps, -1 on error or without convergence.
+ */
+static int solveTransientClass(t_csr_graph graph, t_absorption *a, t_class *c, double tolerance, double *acc) {
+    for (int sweep = 1; sweep <= ABSORPTION_MAX_ITERATIONS; sweep++) {
+        double change = 0.0;
+        for (t_vertex *v = c->vertices; v != NULL; v = v->next) {
+            double state_change = updateTransientState(graph, a, v->value - 1, acc);
+            if (state_change < 0.0) {
+                fprintf(stderr, "computeAbsorption: state %d of transient class %d cannot be left\n",
+                        v->value, c->id);
+                return -1;
+            }
+            change = fmax(change, state_change);
+        }
+        // Un état seul ne dépend que de classes déjà résolues : un passage suffit
+        if (c->vertex_number == 1 || change < tolerance) return sweep;
+    }
+    fprintf(stderr, "computeAbsorption: class %d did not converge in %d sweeps\n",
+            c->id, ABSORPTION_MAX_ITERATIONS);
+    return -1;
+}
+
+/**
+ * @brief Numbers the persistent classes (columns) and the transient states (rows).
+ * @param graph The CSR graph.
+ * @param hasse Hasse diagram of the graph.
+ * @param a Absorption result with row_of_state and column_of_class allocated.
+ * @return 1 on success, -1 if a class id or a vertex class is out of range.
+ */
+static int numberAbsorptionRowsAndColumns(t_csr_graph graph, t_hasse_diagram hasse, t_absorption *a) {
+    int class_count = hasse.partition->class_number;
+    for (int id = 0; id <= class_count; id++) a->column_of_class[id] = -1;
+    for (t_class *c = hasse.partition->classes; c != NULL; c = c->next) {
+        if (c->id < 1 || c->id > class_count) {
+            fprintf(stderr, "computeAbsorption: class ids must be 1..%d\n", class_count);
+            return -1;
+        }
+        if (isPersistantClass(hasse, c->id)) {
+            a->persistent_ids[a->persistent_count] = c->id;
+            a->column_of_class[c->id] = a->persistent_count++;
+        }
+    }
+    for (int s = 0; s < graph.size; s++) {
+        int id = hasse.association_array[s];
+        if (id < 1 || id > class_count) {
+            fprintf(stderr, "computeAbsorption: state %d has no class\n", s + 1);
+            return -1;
+        }
+        int column = a->column_of_class[id];
+        a->row_of_state[s] = (column < 0) ? a->transient_count++ : -1 - column;
+    }
+    return 1;
+}
+
+/* public functions =================================================== */
+
+t_absorption createEmptyAbsorption(void) {
+    t_absorption a = { 0, 0, 0, 0, NULL, NULL, NULL, NULL, NULL, 0 };
+    return a;
+}
+
+int computeAbsorption(t_csr_graph graph, t_hasse_diagram hasse, double tolerance, t_absorption *result) {
+    if (result == NULL || isEmptyCsrGraph(graph) || hasse.partition == NULL ||
+        hasse.association_array == NULL || !(tolerance > 0.0)) {
+        fprintf(stderr, "computeAbsorption: invalid parameters\n");
+        return -1;
+    }
+    int class_count = hasse.partition->class_number;
+    t_absorption a = createEmptyAbsorption();
+    a.size = graph.size;
+    a.class_count = class_count;
+    a.persistent_ids = malloc((size_t)(class_count > 0 ? class_count : 1) * sizeof(int));
+    a.row_of_state = malloc((size_t)graph.size * sizeof(int));
+    a.column_of_class = malloc(((size_t)class_count + 1) * sizeof(int));
+    a.expected_steps = calloc((size_t)graph.size, sizeof(double));
+    if (a.persistent_ids == NULL || a.row_of_state == NULL || a.column_of_class == NULL ||
+        a.expected_steps == NULL) {
+        perror("computeAbsorption: allocation failed");
+        freeAbsorption(&a);
+        return -1;
+    }
+    if (numberAbsorptionRowsAndColumns(graph, hasse, &a) < 0) {
+        freeAbsorption(&a);
+        return -1;
+    }
+
+    size_t cells = (size_t)a.transient_count * (size_t)a.persistent_count;
+    a.probabilities = calloc(cells > 0 ? cells : 1, sizeof(double));
+    double *acc = malloc((size_t)(a.persistent_count > 0 ? a.persistent_count : 1) * sizeof(double));
+    int *order = malloc((size_t)(class_count > 0 ? class_count : 1) * sizeof(int));
+    t_class **classes = calloc((size_t)class_count + 1, sizeof(t_class *));
+    t_condensation_dag dag = createCondensationDagFromCsr(graph, *hasse.partition, hasse.association_array);
+    int ok = a.probabilities != NULL && acc != NULL && order != NULL && classes != NULL &&
+             !isEmptyCondensationDag(dag);
+    if (!ok) {
+        fprintf(stderr, "computeAbsorption: allocation failed for %d transient states x %d persistent classes\n",
+                a.transient_count, a.persistent_count);
+    } else {
+        ok = topologicalOrderCondensationDag(dag, order, NULL) == 1;
+    }
+    if (ok) {
+        for (t_class *c = hasse.partition->classes; c != NULL; c = c->next) classes[c->id] = c;
+        // Ordre topologique inverse : les classes atteintes sont résolues avant
+        for (int p = class_count - 1; p >= 0 && ok; p--) {
+            t_class *c = classes[order[p]];
+            if (a.column_of_class[c->id] >= 0) continue;
+            int sweeps = solveTransientClass(graph, &a, c, tolerance, acc);
+            ok = sweeps > 0;
+            a.sweeps += ok ? sweeps : 0;
+        }
+    }
+    freeCondensationDag(&dag);
+    free(acc);
+    free(order);
+    free(classes);
+    if (!ok) {
+        freeAbsorption(&a);
+        return -1;
+    }
+    *result = a;
+    return 1;
+}
+
+double getAbsorptionProbability(t_absorption absorption, int state, int class_id) {
+    if (absorption.row_of_state == NULL || state < 1 || state > absorption.size ||
+        class_id < 1 || class_id > absorption.class_count || absorption.column_of_class[class_id] < 0) {
+        fprintf(stderr, "getAbsorptionProbability: invalid state %d or persistent class %d\n", state, class_id);
+        return -1.0;
+    }
+    int column = absorption.column_of_class[class_id];
+    int row = absorption.row_of_state[state - 1];
+    // État persistant : il reste dans sa propre classe
+    if (row < 0) return (-1 - row == column) ? 1.0 : 0.0;
+    return absorption.probabilities[(size_t)row * absorption.persistent_count + column];
+}
+
+void displayAbsorption(t_absorption absorption) {
+    if (absorption.row_of_state == NULL) {
+        printf("No absorption result.\n");
+        return;
+    }
+    printf("%d transient state(s), %d persistent class(es)\n", absorption.transient_count, absorption.persistent_count);
+    for (int s = 0; s < absorption.size; s++) {
+        int row = absorption.row_of_state[s];
+        if (row < 0) continue;
+        printf("  State %d : %.4f steps |", s + 1, absorption.expected_steps[s]);
+        for (int r = 0; r < absorption.persistent_count; r++) {
+            printf(" C%d: %.4f", absorption.persistent_ids[r],
+                   absorption.probabilities[(size_t)row * absorption.persistent_count + r]);
+        }
+        printf("\n");
+    }
+}
+
+void freeAbsorption(t_absorption *absorption) {
+    if (absorption == NULL) return;
+    free(absorption->persistent_ids);
+    free(absorption->row_of_state);
+    free(absorption->column_of_class);
+    free(absorption->probabilities);
+    free(absorption->expected_steps);
+    *absorption = createEmptyAbsorption();
+}
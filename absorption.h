@@ -0,0 +1,95 @@
+#ifndef ABSORPTION_H
+#define ABSORPTION_H
+
+#include "csr_graph.h"
+#include "hasse.h"
+
+/**
+ * @file absorption.h
+ * @brief Absorbing-chain analysis: where and when the transient states leave for a persistent class.
+ *
+ * For a transient state i, B(i, r) is the probability of eventually entering
+ * the persistent class r and t(i) the expected number of steps before
+ * entering any persistent class. They solve B = Q B + R and t = Q t + 1,
+ * with Q the transitions between transient states: (I - Q) is never
+ * inverted. The transient classes are solved one at a time in reverse
+ * topological order of the condensation DAG, so that every value leaving a
+ * class is already known, each by Gauss-Seidel sweeps over its own
+ * transitions only.
+ */
+
+/** Default threshold on the relative change of a Gauss-Seidel sweep. */
+#define ABSORPTION_DEFAULT_TOLERANCE 1e-12
+
+/** Sweep cap of the Gauss-Seidel solve of one transient class. */
+#define ABSORPTION_MAX_ITERATIONS 100000
+
+/**
+ * @brief Result of computeAbsorption().
+ * @param size Number of states of the graph
+ * @param class_count Number of classes of the partition
+ * @param transient_count Number of transient states
+ * @param persistent_count Number of persistent classes (columns of probabilities)
+ * @param persistent_ids Class ID of each column
+ * @param row_of_state Row of each state in probabilities (index state - 1),
+ *        -1 - column of its class for a persistent state
+ * @param column_of_class Column of each class ID (class_number + 1 entries), -1 for a transient class
+ * @param probabilities transient_count x persistent_count absorption probabilities, row-major
+ * @param expected_steps Expected steps before absorption of each state (index state - 1), 0 if persistent
+ * @param sweeps Total number of Gauss-Seidel sweeps
+ */
+typedef struct s_absorption {
+    int size;
+    int class_count;
+    int transient_count;
+    int persistent_count;
+    int *persistent_ids;
+    int *row_of_state;
+    int *column_of_class;
+    double *probabilities;
+    double *expected_steps;
+    int sweeps;
+} t_absorption;
+
+/**
+ * @brief Creates an empty absorption result (NULL arrays).
+ * @return The empty result.
+ */
+t_absorption createEmptyAbsorption(void);
+
+/**
+ * @brief Computes absorption probabilities and expected absorption times of a chain.
+ *
+ * Memory: transient_count x persistent_count doubles for the probabilities,
+ * plus O(size + class_number).
+ *
+ * @param graph The CSR graph (rows summing to 1).
+ * @param hasse Hasse diagram of the same graph (partition with ids 1..class_number).
+ * @param tolerance Threshold on the relative change of a sweep (> 0), e.g. ABSORPTION_DEFAULT_TOLERANCE.
+ * @param result Receives the result, to free with freeAbsorption().
+ * @return 1 on success, -1 on error or if a class reaches ABSORPTION_MAX_ITERATIONS.
+ */
+int computeAbsorption(t_csr_graph graph, t_hasse_diagram hasse, double tolerance, t_absorption *result);
+
+/**
+ * @brief Probability that a state eventually enters a persistent class.
+ * @param absorption The result of computeAbsorption().
+ * @param state State (1-indexed).
+ * @param class_id ID of a persistent class.
+ * @return The probability (1 or 0 for a persistent state), -1 on invalid parameters.
+ */
+double getAbsorptionProbability(t_absorption absorption, int state, int class_id);
+
+/**
+ * @brief Displays the absorption probabilities and expected times of the transient states.
+ * @param absorption The result of computeAbsorption().
+ */
+void displayAbsorption(t_absorption absorption);
+
+/**
+ * @brief Frees an absorption result and resets it to empty.
+ * @param absorption Pointer to the result.
+ */
+void freeAbsorption(t_absorption *absorption);
+
+#endif //ABSORPTION_H
@@ -0,0 +1,1134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include "bench.h"
+#include "graph.h"
+#include "graph_loader.h"
+#include "graph_binary.h"
+#include "utils.h"
+#include "matrix.h"
+#include "csr_graph.h"
+#include "propagation.h"
+#include "sparse_matrix.h"
+#include "stationary.h"
+#include "hasse.h"
+#include "tarjan.h"
+#include "scc.h"
+#include "absorption.h"
+#include "hitting.h"
+#include "simulation.h"
+
+static bench_entry g_benchmarks[64];
+static int g_bench_count = 0;
+
+#define BENCH_GRAPH_PATH "bench_graph.txt"
+#define BENCH_BINARY_PATH "bench_graph.bin"
+
+void add_bench(const char *name, bench_fn fn, const char *comment) {
+    if (name == NULL || fn == NULL) return;
+    if (g_bench_count >= (int)(sizeof(g_benchmarks)/sizeof(g_benchmarks[0]))) return;
+    g_benchmarks[g_bench_count].name = name;
+    g_benchmarks[g_bench_count].fn = fn;
+    g_benchmarks[g_bench_count].comment = comment ? comment : "";
+    g_bench_count++;
+}
+
+int run_all_benchmarks(void) {
+    printf("Running %d benchmarks...\n", g_bench_count);
+    int failures = 0;
+    for (int i = 0; i < g_bench_count; ++i) {
+        bench_entry *b = &g_benchmarks[i];
+        printf("Benchmark: %s", b->name);
+        if (b->comment && strlen(b->comment) > 0) {
+            printf(" (%s)", b->comment);
+        }
+        printf("...\n");
+        double start = benchNow();
+        int res = b->fn();
+        printf("[%s] %.3f s\n", res == 0 ? "DONE" : "FAIL", benchNow() - start);
+        if (res != 0) failures++;
+    }
+    printf("Summary: %d benchmarks failed\n", failures);
+    return failures;
+}
+
+double benchNow(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Helpers ============================================================== */
+
+// Générateur pseudo-aléatoire déterministe (LCG) pour des jeux de données reproductibles
+static unsigned int g_bench_seed = 12345u;
+
+static unsigned int benchRandom(void) {
+    g_bench_seed = g_bench_seed * 1103515245u + 12345u;
+    return (g_bench_seed >> 8) & 0xFFFFFF;
+}
+
+// Écrit un graphe de Markov aléatoire (vertices sommets, degree arêtes par sommet)
+static long writeBenchGraphFile(const char *path, int vertices, int degree) {
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        fprintf(stderr, "writeBenchGraphFile: could not open '%s'\n", path);
+        return -1;
+    }
+    fprintf(file, "%d\n", vertices);
+    for (int v = 1; v <= vertices; v++) {
+        for (int d = 0; d < degree; d++) {
+            int dest = 1 + (int)(benchRandom() % (unsigned int)vertices);
+            fprintf(file, "%d %d %.6f\n", v, dest, 1.0 / degree);
+        }
+    }
+    long size = ftell(file);
+    fclose(file);
+    return size;
+}
+
+// Chaîne creuse sans arête en double : une destination par fenêtre de vertices / degree sommets
+static t_graph createBenchChain(int vertices, int degree) {
+    t_graph g = createArenaGraph(vertices);
+    for (int v = 1; v <= vertices; v++) {
+        for (int d = 0; d < degree; d++) {
+            int dest = 1 + (v + d * (vertices / degree) + (int)(benchRandom() % (vertices / degree))) % vertices;
+            addEdge(&g, v, dest, 1.0 / degree);
+        }
+    }
+    return g;
+}
+
+/* Benchmarks =========================================================== */
+
+// Débit de chargement : tokenizer bufferisé contre fscanf
+static int bench_graph_import(void) {
+    long bytes = writeBenchGraphFile(BENCH_GRAPH_PATH, 100000, 10);
+    if (bytes < 0) return 1;
+    double megabytes = (double)bytes / (1024.0 * 1024.0);
+
+    double start = benchNow();
+    t_graph reference = importGraphFromFileWithScanf(BENCH_GRAPH_PATH);
+    double scanf_time = benchNow() - start;
+
+    start = benchNow();
+    t_graph graph = importGraphFromFile(BENCH_GRAPH_PATH);
+    double reader_time = benchNow() - start;
+
+    start = benchNow();
+    t_graph mapped = importGraphFromMappedFile(BENCH_GRAPH_PATH);
+    double mapped_time = benchNow() - start;
+
+    start = benchNow();
+    t_graph parallel = importGraphFromFileParallel(BENCH_GRAPH_PATH, 0);
+    double parallel_time = benchNow() - start;
+
+    printf("  file: %.1f MB\n", megabytes);
+    printf("  fscanf loader    : %8.3f s (%7.1f MB/s)\n", scanf_time, megabytes / scanf_time);
+    printf("  buffered loader  : %8.3f s (%7.1f MB/s)\n", reader_time, megabytes / reader_time);
+    printf("  mmap loader      : %8.3f s (%7.1f MB/s)\n", mapped_time, megabytes / mapped_time);
+    printf("  parallel loader  : %8.3f s (%7.1f MB/s, %d threads)\n", parallel_time, megabytes / parallel_time,
+           resolveThreadCount(0));
+
+    int result = (isSameGraph(reference, graph) && isSameGraph(reference, mapped) &&
+                  isSameGraph(reference, parallel)) ? 0 : 1;
+    freeGraph(&reference);
+    freeGraph(&graph);
+    freeGraph(&mapped);
+    freeGraph(&parallel);
+    remove(BENCH_GRAPH_PATH);
+    return result;
+}
+
+// Chargement binaire : graphe complet et CSR projeté sans copie, contre le chargeur texte
+static int bench_graph_binary_import(void) {
+    if (writeBenchGraphFile(BENCH_GRAPH_PATH, 100000, 10) < 0) return 1;
+    if (convertGraphFileToBinary(BENCH_GRAPH_PATH, BENCH_BINARY_PATH) != 1) {
+        remove(BENCH_GRAPH_PATH);
+        return 1;
+    }
+
+    double start = benchNow();
+    t_graph reference = importGraphFromFile(BENCH_GRAPH_PATH);
+    double text_time = benchNow() - start;
+
+    start = benchNow();
+    t_graph graph = importGraphFromBinaryFile(BENCH_BINARY_PATH);
+    double binary_time = benchNow() - start;
+
+    start = benchNow();
+    t_csr_graph csr = importCsrGraphFromBinaryFile(BENCH_BINARY_PATH);
+    double csr_time = benchNow() - start;
+
+    printf("  text loader           : %8.4f s\n", text_time);
+    printf("  binary loader (graph) : %8.4f s\n", binary_time);
+    printf("  binary loader (CSR)   : %8.4f s\n", csr_time);
+
+    int result = (isSameGraph(reference, graph) && csr.edge_count == 1000000) ? 0 : 1;
+    freeCsrGraph(&csr);
+    freeGraph(&reference);
+    freeGraph(&graph);
+    remove(BENCH_GRAPH_PATH);
+    remove(BENCH_BINARY_PATH);
+    return result;
+}
+
+// Matrice aléatoire dense (lignes stochastiques non normalisées)
+static void fillBenchMatrix(t_matrix m) {
+    for (int i = 0; i < m.rows; i++) {
+        for (int j = 0; j < m.cols; j++) {
+            m.data[i][j] = (double)(benchRandom() % 1000) / 1000.0;
+        }
+    }
+}
+
+// Ancienne disposition : une allocation par ligne, produit i-j-k
+static double **createRowAllocatedCopy(t_matrix m) {
+    double **rows = malloc((size_t)m.rows * sizeof *rows);
+    if (rows == NULL) return NULL;
+    for (int i = 0; i < m.rows; i++) {
+        rows[i] = calloc((size_t)m.cols, sizeof **rows);
+        if (rows[i] != NULL) memcpy(rows[i], m.data[i], (size_t)m.cols * sizeof **rows);
+    }
+    return rows;
+}
+
+static void freeRowAllocated(double **rows, int count) {
+    for (int i = 0; i < count; i++) free(rows[i]);
+    free(rows);
+}
+
+// Produit matriciel : lignes allouées séparément contre stockage contigu
+static int bench_matrix_multiply(void) {
+    const int sizes[] = { 128, 256, 512 };
+    int result = 0;
+    for (int s = 0; s < (int)(sizeof(sizes)/sizeof(sizes[0])); s++) {
+        int n = sizes[s];
+        t_matrix a = createMatrix(n, n), b = createMatrix(n, n), c;
+        if (!isValidMatrix(a) || !isValidMatrix(b)) return 1;
+        fillBenchMatrix(a);
+        fillBenchMatrix(b);
+        double **ra = createRowAllocatedCopy(a), **rb = createRowAllocatedCopy(b);
+        double **rc = createRowAllocatedCopy(a);
+
+        double start = benchNow();
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                rc[i][j] = 0.0;
+                for (int k = 0; k < n; k++) {
+                    rc[i][j] += ra[i][k] * rb[k][j];
+                }
+            }
+        }
+        double rows_time = benchNow() - start;
+
+        start = benchNow();
+        multiplyMatrices(a, b, &c);
+        double product_time = benchNow() - start;
+
+        double gflop = 2.0 * n * (double)n * n * 1e-9;
+        printf("  n = %4d : row-allocated %8.4f s (%5.2f GFLOP/s), multiplyMatrices %8.4f s (%5.2f GFLOP/s)\n",
+               n, rows_time, gflop / rows_time, product_time, gflop / product_time);
+
+        for (int i = 0; i < n; i++) {
+            if (memcmp(rc[i], c.data[i], (size_t)n * sizeof(double)) != 0) result = 1;
+        }
+        freeRowAllocated(ra, n);
+        freeRowAllocated(rb, n);
+        freeRowAllocated(rc, n);
+        freeMatrix(&a);
+        freeMatrix(&b);
+        freeMatrix(&c);
+    }
+    return result;
+}
+
+// Débit du produit par blocs pour chaque noyau disponible, n = 64 à 4096
+static int bench_matrix_multiply_kernels(void) {
+    const t_matrix_kernel kernels[] = { MATRIX_KERNEL_SCALAR, MATRIX_KERNEL_AVX2, MATRIX_KERNEL_AVX512 };
+    t_matrix_kernel best = getMatrixKernel();
+    for (int n = 64; n <= 4096; n *= 2) {
+        t_matrix a = createMatrix(n, n), b = createMatrix(n, n);
+        if (!isValidMatrix(a) || !isValidMatrix(b)) return 1;
+        fillBenchMatrix(a);
+        fillBenchMatrix(b);
+        printf("  n = %4d :", n);
+        for (int t = 0; t < (int)(sizeof(kernels)/sizeof(kernels[0])); t++) {
+            // Au-delà de 1024, seul le noyau choisi par défaut est mesuré
+            if ((n > 1024 && kernels[t] != best) || selectMatrixKernel(kernels[t]) < 0) continue;
+            t_matrix c;
+            double start = benchNow();
+            multiplyMatrices(a, b, &c);
+            double elapsed = benchNow() - start;
+            printf(" %s %6.2f GFLOP/s", getMatrixKernelName(kernels[t]), 2.0 * n * (double)n * n * 1e-9 / elapsed);
+            freeMatrix(&c);
+        }
+        printf("\n");
+        freeMatrix(&a);
+        freeMatrix(&b);
+    }
+    selectMatrixKernel(best);
+    return 0;
+}
+
+// Ancien powerMatrix : M^n = M x M^(n-1), une récursion et une allocation par niveau
+static int powerMatrixLinear(t_matrix m, int power, t_matrix *result) {
+    if (power <= 1) return powerMatrix(m, power, result);
+    t_matrix temp;
+    if (powerMatrixLinear(m, power - 1, &temp) < 0) return -1;
+    int status = multiplyMatrices(m, temp, result);
+    freeMatrix(&temp);
+    return status;
+}
+
+// Puissance de matrice : produits successifs contre exponentiation rapide
+static int bench_matrix_power(void) {
+    const int powers[] = { 10, 100, 2000 };
+    const int n = 64;
+    t_matrix m = createMatrix(n, n);
+    if (!isValidMatrix(m)) return 1;
+    fillBenchMatrix(m);
+    // Lignes stochastiques pour que les puissances restent bornées
+    for (int i = 0; i < n; i++) {
+        double sum = 0.0;
+        for (int j = 0; j < n; j++) sum += m.data[i][j];
+        for (int j = 0; j < n; j++) m.data[i][j] /= sum;
+    }
+
+    int result = 0;
+    for (int p = 0; p < (int)(sizeof(powers)/sizeof(powers[0])); p++) {
+        t_matrix linear, squared;
+        double start = benchNow();
+        int status = powerMatrixLinear(m, powers[p], &linear);
+        double linear_time = benchNow() - start;
+
+        start = benchNow();
+        status += powerMatrix(m, powers[p], &squared);
+        double squared_time = benchNow() - start;
+
+        if (status != 2) return 1;
+        double diff = diffMatrices(linear, squared);
+        printf("  %dx%d, n = %4d : repeated %8.4f s, squaring %8.4f s (x%.0f), diff %.2e\n",
+               n, n, powers[p], linear_time, squared_time, linear_time / squared_time, diff);
+        if (diff > 1e-9) result = 1;
+        freeMatrix(&linear);
+        freeMatrix(&squared);
+    }
+    freeMatrix(&m);
+    return result;
+}
+
+// Ancienne boucle de convergence : M^n recalculée depuis M pour chaque n
+static int convergedPowerFromScratch(t_matrix m, double epsilon, int maxIter) {
+    t_matrix prev, curr;
+    if (powerMatrix(m, 1, &prev) < 0) return -1;
+    for (int n = 2; n <= maxIter; n++) {
+        if (powerMatrix(m, n, &curr) < 0) break;
+        double diff = diffMatrices(prev, curr);
+        freeMatrix(&prev);
+        prev = curr;
+        if (diff < epsilon) {
+            freeMatrix(&prev);
+            return n;
+        }
+    }
+    freeMatrix(&prev);
+    return -1;
+}
+
+// Convergence de M^n sur une marche paresseuse sur un cycle (convergence lente)
+static int bench_converged_power(void) {
+    const int n = 32;
+    t_matrix m = createMatrix(n, n);
+    if (!isValidMatrix(m)) return 1;
+    for (int i = 0; i < n; i++) {
+        m.data[i][i] = 0.5;
+        m.data[i][(i + 1) % n] = 0.25;
+        m.data[i][(i + n - 1) % n] = 0.25;
+    }
+
+    double start = benchNow();
+    int scratch_n = convergedPowerFromScratch(m, 1e-3, 20000);
+    double scratch_time = benchNow() - start;
+
+    t_matrix limit;
+    start = benchNow();
+    int incremental_n = computeConvergedMatrixPower(m, 1e-3, &limit, 20000);
+    double incremental_time = benchNow() - start;
+    if (incremental_n > 0) freeMatrix(&limit);
+
+    start = benchNow();
+    int doubling_n = computeConvergedMatrixPowerWithMode(m, 1e-3, &limit, 1 << 30, CONVERGENCE_DOUBLING);
+    double doubling_time = benchNow() - start;
+    if (doubling_n > 0) freeMatrix(&limit);
+
+    printf("  from scratch : n = %5d, %8.4f s\n", scratch_n, scratch_time);
+    printf("  incremental  : n = %5d, %8.4f s\n", incremental_n, incremental_time);
+    printf("  doubling     : n = %5d, %8.4f s\n", doubling_n, doubling_time);
+    freeMatrix(&m);
+    return (scratch_n > 0 && scratch_n == incremental_n && doubling_n > 0) ? 0 : 1;
+}
+
+// Distribution après n pas : M^n dense, produits vecteur x matrice, propagation sur le CSR
+static int bench_distribution_steps(void) {
+    const int vertices = 1000, steps = 100, degree = 10;
+    t_graph g = createBenchChain(vertices, degree);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_matrix m, initial, by_power, m_power, by_vector;
+    if (g.size == 0 || createMatrixFromGraph(g, &m) < 0) return 1;
+    initial = createMatrix(1, vertices);
+    initial.data[0][0] = 1.0;
+
+    double start = benchNow();
+    powerMatrix(m, steps, &m_power);
+    multiplyMatrices(initial, m_power, &by_power);
+    double power_time = benchNow() - start;
+
+    start = benchNow();
+    computeDistributionAfterNSteps(m, initial, steps, &by_vector);
+    double vector_time = benchNow() - start;
+
+    double *on_csr = calloc((size_t)vertices, sizeof *on_csr);
+    on_csr[0] = 1.0;
+    start = benchNow();
+    propagateDistributionOnCsrGraph(csr, on_csr, steps, NULL, NULL);
+    double csr_time = benchNow() - start;
+
+    double diff = diffMatrices(by_power, by_vector), csr_diff = 0.0;
+    for (int i = 0; i < vertices; i++) csr_diff += fabs(on_csr[i] - by_vector.data[0][i]);
+    printf("  %d states, %d edges, n = %d\n", vertices, csr.edge_count, steps);
+    printf("  initial x M^n     : %8.4f s\n", power_time);
+    printf("  vector x M (dense): %8.4f s (diff %.2e)\n", vector_time, diff);
+    printf("  CSR propagation   : %8.4f s (diff %.2e)\n", csr_time, csr_diff);
+
+    free(on_csr);
+    freeMatrix(&m);
+    freeMatrix(&initial);
+    freeMatrix(&m_power);
+    freeMatrix(&by_power);
+    freeMatrix(&by_vector);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return (diff < 1e-9 && csr_diff < 1e-9) ? 0 : 1;
+}
+
+// Matrice creuse vs dense : mémoire, distribution après n pas, produits
+static int bench_sparse_matrix(void) {
+    const int vertices = 2000, steps = 100, degree = 10;
+    t_graph g = createBenchChain(vertices, degree);
+    t_matrix m, initial, dense_dist, sparse_dist, dense_square, sparse_dense_square;
+    t_sparse_matrix sparse, sparse_square;
+    if (g.size == 0 || createMatrixFromGraph(g, &m) < 0) return 1;
+    if (createSparseMatrixFromGraph(g, &sparse) < 0) { freeMatrix(&m); freeGraph(&g); return 1; }
+    initial = createMatrix(1, vertices);
+    initial.data[0][0] = 1.0;
+
+    double dense_bytes = (double)m.rows * m.stride * sizeof(double);
+    double sparse_bytes = (double)(sparse.rows + 1) * sizeof(int) +
+                          (double)sparse.nnz * (sizeof(int) + sizeof(double));
+
+    double start = benchNow();
+    computeDistributionAfterNSteps(m, initial, steps, &dense_dist);
+    double dense_dist_time = benchNow() - start;
+    start = benchNow();
+    computeSparseDistributionAfterNSteps(sparse, initial, steps, &sparse_dist);
+    double sparse_dist_time = benchNow() - start;
+
+    start = benchNow();
+    multiplyMatrices(m, m, &dense_square);
+    double dense_square_time = benchNow() - start;
+    start = benchNow();
+    multiplySparseDenseMatrices(sparse, m, &sparse_dense_square);
+    double sparse_dense_time = benchNow() - start;
+    start = benchNow();
+    multiplySparseMatrices(sparse, sparse, &sparse_square);
+    double sparse_square_time = benchNow() - start;
+
+    double dist_diff = diffMatrices(dense_dist, sparse_dist);
+    double square_diff = diffMatrices(dense_square, sparse_dense_square);
+    printf("  %d states, %d stored entries\n", vertices, sparse.nnz);
+    printf("  memory            : dense %8.2f MB, sparse %8.3f MB\n", dense_bytes / 1e6, sparse_bytes / 1e6);
+    printf("  distribution n=%d: dense %8.4f s, sparse %8.4f s (diff %.2e)\n",
+           steps, dense_dist_time, sparse_dist_time, dist_diff);
+    printf("  M x M             : dense %8.4f s, sparse x dense %8.4f s (diff %.2e), sparse x sparse %8.4f s (%d entries)\n",
+           dense_square_time, sparse_dense_time, square_diff, sparse_square_time, sparse_square.nnz);
+
+    freeSparseMatrix(&sparse_square);
+    freeMatrix(&sparse_dense_square);
+    freeMatrix(&dense_square);
+    freeMatrix(&sparse_dist);
+    freeMatrix(&dense_dist);
+    freeMatrix(&initial);
+    freeSparseMatrix(&sparse);
+    freeMatrix(&m);
+    freeGraph(&g);
+    return (dist_diff < 1e-9 && square_diff < 1e-9) ? 0 : 1;
+}
+
+// Distribution stationnaire : ligne de M^n convergée vs itérations sur des vecteurs
+static int bench_stationary_distribution(void) {
+    const int vertices = 300, degree = 10;
+    t_graph g = createBenchChain(vertices, degree);
+    t_matrix m, limit;
+    t_sparse_matrix sparse;
+    if (g.size == 0 || createMatrixFromGraph(g, &m) < 0) return 1;
+    if (createSparseMatrixFromGraph(g, &sparse) < 0) { freeMatrix(&m); freeGraph(&g); return 1; }
+
+    double start = benchNow();
+    int power_n = computeConvergedMatrixPower(m, 1e-9, &limit, 2000);
+    double power_time = benchNow() - start;
+
+    double *pi = malloc((size_t)vertices * sizeof *pi);
+    start = benchNow();
+    int power_iter = computeStationaryDistribution(sparse, STATIONARY_POWER, STATIONARY_DEFAULT_TOLERANCE,
+                                                   STATIONARY_MAX_ITERATIONS, pi);
+    double vector_time = benchNow() - start;
+    start = benchNow();
+    int lazy_iter = computeStationaryDistribution(sparse, STATIONARY_LAZY, STATIONARY_DEFAULT_TOLERANCE,
+                                                  STATIONARY_MAX_ITERATIONS, pi);
+    double lazy_time = benchNow() - start;
+
+    double diff = 0.0;
+    if (power_n > 0) {
+        for (int j = 0; j < vertices; j++) diff += fabs(pi[j] - limit.data[0][j]);
+        freeMatrix(&limit);
+    }
+    printf("  %d states, %d edges\n", vertices, sparse.nnz);
+    printf("  converged M^n    : n = %6d, %8.4f s\n", power_n, power_time);
+    printf("  power iteration  : %6d it, %8.4f s\n", power_iter, vector_time);
+    printf("  lazy iteration   : %6d it, %8.4f s (diff %.2e)\n", lazy_iter, lazy_time, diff);
+
+    free(pi);
+    freeSparseMatrix(&sparse);
+    freeMatrix(&m);
+    freeGraph(&g);
+    return (power_n > 0 && power_iter >= 0 && lazy_iter >= 0 && diff < 1e-6) ? 0 : 1;
+}
+
+// Distribution stationnaire : M^n convergée vs GTH vs LU vs itérations, selon la taille de la classe
+static int bench_stationary_solvers(void) {
+    const int sizes[] = { 100, 300, 1000, 2000 };
+    const int degree = 10;
+    int failures = 0;
+    printf("  %6s %12s %10s %10s %10s %10s\n", "states", "M^n", "GTH", "LU", "iterative", "auto");
+    for (int s = 0; s < (int)(sizeof sizes / sizeof sizes[0]); s++) {
+        int n = sizes[s];
+        t_graph g = createBenchChain(n, degree);
+        t_matrix m, limit;
+        t_sparse_matrix sparse;
+        if (g.size == 0 || createMatrixFromGraph(g, &m) < 0) return 1;
+        if (createSparseMatrixFromGraph(g, &sparse) < 0) { freeMatrix(&m); freeGraph(&g); return 1; }
+        double *gth = malloc((size_t)n * sizeof *gth);
+        double *lu = malloc((size_t)n * sizeof *lu);
+        double *iterative = malloc((size_t)n * sizeof *iterative);
+
+        // M^n convergée : O(N^3) par itération, limité aux petites classes
+        double power_time = -1.0;
+        if (n <= 300) {
+            double start = benchNow();
+            if (computeConvergedMatrixPower(m, 1e-9, &limit, 2000) > 0) {
+                power_time = benchNow() - start;
+                freeMatrix(&limit);
+            }
+        }
+        double start = benchNow();
+        int ok = computeStationaryDistributionGTH(m, gth) == 1;
+        double gth_time = benchNow() - start;
+        start = benchNow();
+        ok = ok && computeStationaryDistributionLU(m, lu) == 1;
+        double lu_time = benchNow() - start;
+        start = benchNow();
+        ok = ok && solveStationaryDistribution(sparse, STATIONARY_SOLVER_ITERATIVE, STATIONARY_DEFAULT_TOLERANCE,
+                                               iterative) == 1;
+        double iterative_time = benchNow() - start;
+
+        double diff = 0.0;
+        for (int j = 0; j < n; j++) diff += fabs(gth[j] - lu[j]) + fabs(gth[j] - iterative[j]);
+        if (!ok || diff > 1e-6) failures++;
+        if (power_time >= 0.0) {
+            printf("  %6d %10.4f s", n, power_time);
+        } else {
+            printf("  %6d %12s", n, "-");
+        }
+        printf(" %8.4f s %8.4f s %8.4f s %10s\n", gth_time, lu_time, iterative_time,
+               getStationarySolverName(chooseStationarySolver(n, sparse.nnz)));
+
+        free(gth);
+        free(lu);
+        free(iterative);
+        freeSparseMatrix(&sparse);
+        freeMatrix(&m);
+        freeGraph(&g);
+    }
+    return failures;
+}
+
+// Distributions stationnaires de nombreuses classes : un thread vs le pool de threads
+static int bench_stationary_classes(void) {
+    const int classes = 20, class_size = 150, degree = 10;
+    const int vertices = classes * class_size;
+    // Classes fermées indépendantes, chacune construite comme createBenchChain()
+    t_graph g = createArenaGraph(vertices);
+    for (int c = 0; c < classes; c++) {
+        int base = c * class_size;
+        for (int v = 0; v < class_size; v++) {
+            for (int d = 0; d < degree; d++) {
+                int dest = (v + 1 + d * (class_size / degree) + (int)(benchRandom() % (class_size / degree))) % class_size;
+                addEdge(&g, base + v + 1, base + dest + 1, 1.0 / degree);
+            }
+        }
+    }
+    t_matrix m;
+    if (createMatrixFromGraph(g, &m) < 0) { freeGraph(&g); return 1; }
+    t_hasse_diagram hasse = createHasseDiagram(g);
+    t_partition part = *hasse.partition;
+    t_matrix *sequential = calloc((size_t)part.class_number, sizeof *sequential);
+    t_matrix *parallel = calloc((size_t)part.class_number, sizeof *parallel);
+
+    double start = benchNow();
+    int ok = computeStationaryDistributions(m, part, hasse, STATIONARY_DEFAULT_TOLERANCE, 1, sequential) == 1;
+    double sequential_time = benchNow() - start;
+    start = benchNow();
+    ok = ok && computeStationaryDistributions(m, part, hasse, STATIONARY_DEFAULT_TOLERANCE, 0, parallel) == 1;
+    double parallel_time = benchNow() - start;
+
+    int index = 0;
+    for (t_class *c = part.classes; c != NULL; c = c->next, index++) {
+        if (memcmp(sequential[index].values, parallel[index].values,
+                   (size_t)c->vertex_number * sizeof(double)) != 0) ok = 0;
+        freeMatrix(&sequential[index]);
+        freeMatrix(&parallel[index]);
+    }
+    printf("  %d classes of %d states\n", part.class_number, class_size);
+    printf("  1 thread(s) : %8.4f s\n", sequential_time);
+    printf("  %d thread(s) : %8.4f s (identical: %s)\n", resolveThreadCount(0), parallel_time, ok ? "yes" : "no");
+
+    free(sequential);
+    free(parallel);
+    freeHasseDiagram(&hasse);
+    freeMatrix(&m);
+    freeGraph(&g);
+    return ok ? 0 : 1;
+}
+
+// Tarjan : récursif vs itératif, puis itératif seul sur une chaîne de 10 millions d'états
+static int bench_tarjan(void) {
+    const int vertices = 20000, degree = 4, chain_size = 10000000;
+    t_graph g = createBenchChain(vertices, degree);
+
+    double start = benchNow();
+    t_partition *recursive = tarjanRecursive(g);
+    double recursive_time = benchNow() - start;
+    start = benchNow();
+    t_partition *iterative = tarjan(g);
+    double iterative_time = benchNow() - start;
+    int ok = recursive != NULL && iterative != NULL && recursive->class_number == iterative->class_number;
+    int classes = ok ? iterative->class_number : -1;
+    freePartition(recursive);
+    freePartition(iterative);
+    freeGraph(&g);
+
+    // Chaîne de naissance et de mort : profondeur de DFS égale au nombre d'états
+    g = createArenaGraph(chain_size);
+    for (int v = 1; v <= chain_size; v++) {
+        addEdge(&g, v, v < chain_size ? v + 1 : v, 0.5);
+        addEdge(&g, v, v > 1 ? v - 1 : v, 0.5);
+    }
+    start = benchNow();
+    iterative = tarjan(g);
+    double chain_time = benchNow() - start;
+    ok = ok && iterative != NULL && iterative->class_number == 1;
+    freePartition(iterative);
+    freeGraph(&g);
+
+    printf("  %d states, %d classes: recursive %8.4f s, iterative %8.4f s\n",
+           vertices, classes, recursive_time, iterative_time);
+    printf("  %d-state birth-death chain: iterative %8.4f s\n", chain_size, chain_time);
+    return ok ? 0 : 1;
+}
+
+// Temps de tarjanCsr() et de parallelScc() (1 thread puis nombre par défaut) sur un graphe CSR
+static int benchSccEngines(const char *label, t_graph g) {
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    double start = benchNow();
+    t_partition *reference = tarjanCsr(csr);
+    double tarjan_time = benchNow() - start;
+    start = benchNow();
+    t_partition *single = parallelScc(csr, 1);
+    double single_time = benchNow() - start;
+    start = benchNow();
+    t_partition *multi = parallelScc(csr, 0);
+    double multi_time = benchNow() - start;
+    int ok = reference != NULL && single != NULL && multi != NULL &&
+             reference->class_number == single->class_number &&
+             single->class_number == multi->class_number;
+    printf("  %s: %d states, %d edges, %d classes\n", label, csr.size, csr.edge_count,
+           reference != NULL ? reference->class_number : -1);
+    printf("    tarjan            : %8.4f s\n", tarjan_time);
+    printf("    parallel 1 thread : %8.4f s\n", single_time);
+    printf("    parallel %d thread(s): %8.4f s (same classes: %s)\n", resolveThreadCount(0), multi_time, ok ? "yes" : "no");
+    freePartition(reference);
+    freePartition(single);
+    freePartition(multi);
+    freeCsrGraph(&csr);
+    return ok;
+}
+
+// Moteurs SCC : Tarjan séquentiel vs trim / forward-backward / coloring sur des graphes synthétiques
+static int bench_scc_engines(void) {
+    const int vertices = 200000, degree = 4, blocks = 2000, block_size = 100, chain_size = 2000000;
+    // Une seule grande classe
+    t_graph g = createBenchChain(vertices, degree);
+    int ok = benchSccEngines("random chain", g);
+    freeGraph(&g);
+
+    // Beaucoup de classes moyennes (cycles avec raccourcis) reliées en DAG
+    g = createArenaGraph(blocks * block_size);
+    for (int b = 0; b < blocks; b++) {
+        int base = b * block_size;
+        for (int v = 0; v < block_size; v++) {
+            addEdge(&g, base + v + 1, base + (v + 1) % block_size + 1, 0.5);
+            addEdge(&g, base + v + 1, base + (int)(benchRandom() % block_size) + 1, 0.25);
+            int next = b + 1 + (int)(benchRandom() % 8);
+            if (next < blocks) addEdge(&g, base + v + 1, next * block_size + (int)(benchRandom() % block_size) + 1, 0.25);
+            else addEdge(&g, base + v + 1, base + v + 1, 0.25);
+        }
+    }
+    ok = benchSccEngines("DAG of cycles", g) && ok;
+    freeGraph(&g);
+
+    // Chaîne sans retour : tout est éliminé par le trim
+    g = createArenaGraph(chain_size);
+    for (int v = 1; v < chain_size; v++) addEdge(&g, v, v + 1, 1.0);
+    addEdge(&g, chain_size, chain_size, 1.0);
+    ok = benchSccEngines("one-way chain", g) && ok;
+    freeGraph(&g);
+    return ok ? 0 : 1;
+}
+
+// Liens entre classes : addLink (recherche linéaire des doublons) vs DAG de condensation
+static int bench_hasse_links(void) {
+    const int blocks = 1000, block_size = 20, fan_out = 32;
+    t_graph g = createArenaGraph(blocks * block_size);
+    // Cycles reliés chacun à des cycles suivants choisis au hasard : beaucoup de liens distincts
+    for (int b = 0; b < blocks; b++) {
+        int base = b * block_size;
+        for (int v = 0; v < block_size; v++) {
+            addEdge(&g, base + v + 1, base + (v + 1) % block_size + 1, 0.5);
+            for (int k = 0; k < 2; k++) {
+                int next = b + 1 + (int)(benchRandom() % fan_out);
+                if (next < blocks) addEdge(&g, base + v + 1, next * block_size + (int)(benchRandom() % block_size) + 1, 0.25);
+                else addEdge(&g, base + v + 1, base + v + 1, 0.25);
+            }
+        }
+    }
+    t_partition *part = tarjan(g);
+    t_association_array assoc = createAssociationArray(g, *part);
+
+    double start = benchNow();
+    t_link_array links = { malloc((size_t)g.size * sizeof(t_link)), part, assoc, 0, g.size, NULL, NULL };
+    for (int i = 0; i < g.size; i++)
+        for (t_cell *cur = g.values[i].head; cur != NULL; cur = cur->next)
+            if (assoc[i] != assoc[cur->vertex - 1]) addLink(&links, assoc[i], assoc[cur->vertex - 1]);
+    double add_link_time = benchNow() - start;
+
+    start = benchNow();
+    t_condensation_dag dag = createCondensationDag(g, *part, assoc);
+    double dag_time = benchNow() - start;
+
+    int ok = !isEmptyCondensationDag(dag) && dag.edge_count == links.logical_size;
+    printf("  %d states, %d classes, %d links\n", g.size, part->class_number, dag.edge_count);
+    printf("  addLink           : %8.4f s\n", add_link_time);
+    printf("  condensation DAG  : %8.4f s\n", dag_time);
+
+    freeCondensationDag(&dag);
+    free(links.links);
+    free(assoc);
+    freePartition(part);
+    freeGraph(&g);
+    return ok ? 0 : 1;
+}
+
+// DAG aléatoire : chaque état relié à degree états suivants parmi les window suivants, un état par classe
+static t_graph createBenchDag(int vertices, int degree, int window) {
+    t_graph g = createArenaGraph(vertices);
+    for (int v = 1; v < vertices; v++) {
+        for (int d = 0; d < degree; d++) {
+            int dest = v + 1 + (int)(benchRandom() % (unsigned int)window);
+            addEdge(&g, v, dest <= vertices ? dest : vertices, 1.0 / degree);
+        }
+    }
+    addEdge(&g, vertices, vertices, 1.0);
+    return g;
+}
+
+// Réduction transitive : removeTransitiveLinks (O(L^3)) vs bitsets en ordre topologique
+static int bench_transitive_reduction(void) {
+    const int small = 600, large = 30000, degree = 4, window = 50;
+    t_graph g = createBenchDag(small, degree, window);
+    t_partition *part = tarjan(g);
+    t_association_array assoc = createAssociationArray(g, *part);
+    t_condensation_dag dag = createCondensationDag(g, *part, assoc);
+    t_link_array links = { malloc((size_t)maxInt(dag.edge_count, 1) * sizeof(t_link)), part, assoc, 0, dag.edge_count, NULL, NULL };
+    for (int c = 1; c <= dag.class_count; c++)
+        for (int e = dag.offsets[c]; e < dag.offsets[c + 1]; e++)
+            links.links[links.logical_size++] = (t_link){ c, dag.targets[e] };
+    int before = dag.edge_count;
+
+    double start = benchNow();
+    removeTransitiveLinks(&links);
+    double old_time = benchNow() - start;
+    start = benchNow();
+    int ok = reduceCondensationDag(&dag) >= 0;
+    double bitset_time = benchNow() - start;
+    printf("  %d classes, %d links\n", dag.class_count, before);
+    printf("  removeTransitiveLinks : %8.4f s (%d links kept, two-link paths only)\n", old_time, links.logical_size);
+    printf("  bitsets               : %8.4f s (%d links kept)\n", bitset_time, dag.edge_count);
+    ok = ok && dag.edge_count <= links.logical_size;
+    free(links.links);
+    freeCondensationDag(&dag);
+    free(assoc);
+    freePartition(part);
+    freeGraph(&g);
+
+    g = createBenchDag(large, degree, window);
+    part = tarjan(g);
+    assoc = createAssociationArray(g, *part);
+    dag = createCondensationDag(g, *part, assoc);
+    before = dag.edge_count;
+    start = benchNow();
+    ok = ok && reduceCondensationDag(&dag) >= 0;
+    bitset_time = benchNow() - start;
+    printf("  %d classes, %d links: bitsets %8.4f s (%d links kept)\n", dag.class_count, before, bitset_time, dag.edge_count);
+    freeCondensationDag(&dag);
+    free(assoc);
+    freePartition(part);
+    freeGraph(&g);
+    return ok ? 0 : 1;
+}
+
+// Classes persistantes et états absorbants : parcours des liens à chaque requête vs degrés précalculés
+static int bench_class_degrees(void) {
+    const int vertices = 5000, degree = 2, window = 20;
+    // DAG aléatoire : une classe par état, le dernier état absorbant
+    t_graph g = createBenchDag(vertices, degree, window);
+    t_hasse_diagram hasse = createHasseDiagram(g);
+    t_hasse_diagram scan = hasse;
+    scan.out_degrees = NULL;
+    scan.class_sizes = NULL;
+    int *states = malloc((size_t)vertices * sizeof(int));
+
+    double start = benchNow();
+    int scan_persistent = 0, scan_absorbing = 0;
+    for (int id = 1; id <= hasse.partition->class_number; id++) scan_persistent += isPersistantClass(scan, id);
+    for (int s = 1; s <= vertices; s++) scan_absorbing += isAbsorbingState(scan, s, vertices);
+    double scan_time = benchNow() - start;
+
+    start = benchNow();
+    int persistent = 0;
+    for (int id = 1; id <= hasse.partition->class_number; id++) persistent += isPersistantClass(hasse, id);
+    int absorbing = findAbsorbingStates(hasse, vertices, states);
+    double degree_time = benchNow() - start;
+
+    printf("  %d states, %d classes, %d links\n", vertices, hasse.partition->class_number, hasse.logical_size);
+    printf("  scan links per query : %8.4f s\n", scan_time);
+    printf("  class degrees        : %8.6f s (%d persistent, %d absorbing)\n", degree_time, persistent, absorbing);
+    int ok = persistent == scan_persistent && absorbing == scan_absorbing;
+    free(states);
+    freeHasseDiagram(&hasse);
+    freeGraph(&g);
+    return ok ? 0 : 1;
+}
+
+// Absorption : toutes les probabilités et durées d'un coup vs propagation depuis un seul état
+static int bench_absorption(void) {
+    const int blocks = 40000, absorbing = 4, steps = 1000;
+    const int size = 3 * blocks + absorbing;
+    // Cycles transitoires de 3 états fuyant vers des cycles suivants, puis vers 4 états absorbants
+    t_graph g = createArenaGraph(size);
+    for (int b = 0; b < blocks; b++) {
+        for (int k = 0; k < 3; k++) {
+            int v = 3 * b + k + 1;
+            int ahead = b + 1 + (int)(benchRandom() % 16);
+            int next = (ahead < blocks) ? 3 * ahead + (int)(benchRandom() % 3) + 1
+                                        : 3 * blocks + (int)(benchRandom() % absorbing) + 1;
+            addEdge(&g, v, 3 * b + (k + 1) % 3 + 1, 0.7);
+            addEdge(&g, v, next, 0.3);
+        }
+    }
+    for (int v = 3 * blocks + 1; v <= size; v++) addEdge(&g, v, v, 1.0);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_hasse_diagram hasse = createHasseDiagramFromCsr(csr);
+
+    t_absorption a = createEmptyAbsorption();
+    double start = benchNow();
+    int ok = computeAbsorption(csr, hasse, ABSORPTION_DEFAULT_TOLERANCE, &a) == 1;
+    double absorption_time = benchNow() - start;
+
+    double *distribution = calloc((size_t)size, sizeof(double));
+    distribution[0] = 1.0;
+    start = benchNow();
+    ok = ok && propagateDistributionOnCsrGraph(csr, distribution, steps, NULL, NULL) == steps;
+    double propagation_time = benchNow() - start;
+
+    printf("  %d transient states, %d persistent classes\n", a.transient_count, a.persistent_count);
+    printf("  computeAbsorption (all states)   : %8.4f s (%d sweeps, state 1: %.2f steps)\n",
+           absorption_time, a.sweeps, ok ? a.expected_steps[0] : -1.0);
+    printf("  %d propagation steps (state 1) : %8.4f s\n", steps, propagation_time);
+
+    free(distribution);
+    freeAbsorption(&a);
+    freeHasseDiagram(&hasse);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return ok ? 0 : 1;
+}
+
+// Périodes des classes : coût du calcul, puis itérations évitées sur les classes périodiques ou apériodiques
+static int bench_class_periods(void) {
+    const int vertices = 1000000, degree = 4, ring = 300, products = 20, solved = 200000;
+    t_graph g = createBenchChain(vertices, degree);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    freeGraph(&g);
+    t_partition *partition = computeSccPartition(csr, SCC_ENGINE_PARALLEL, 0);
+    int *association_array = malloc((size_t)vertices * sizeof(int));
+    int ok = partition != NULL && association_array != NULL;
+    for (t_class *c = ok ? partition->classes : NULL; c != NULL; c = c->next) {
+        for (t_vertex *v = c->vertices; v != NULL; v = v->next) association_array[v->value - 1] = c->id;
+    }
+    double start = benchNow();
+    ok = ok && computeClassPeriods(csr, partition, association_array) == 1;
+    double periods_time = benchNow() - start;
+    int periodic = 0;
+    for (t_class *c = ok ? partition->classes : NULL; c != NULL; c = c->next) periodic += (c->period > 1);
+    printf("  computeClassPeriods, %d states, %d classes : %8.4f s (%d periodic)\n",
+           vertices, ok ? partition->class_number : 0, periods_time, periodic);
+    free(association_array);
+    if (partition != NULL) freePartition(partition);
+    freeCsrGraph(&csr);
+
+    // Anneau de période 2 : M^n oscille, la détection remplace 2000 produits
+    t_graph r = createArenaGraph(ring);
+    for (int v = 1; v <= ring; v++) {
+        addEdge(&r, v, v % ring + 1, 0.5);
+        addEdge(&r, v, (v + ring - 2) % ring + 1, 0.5);
+    }
+    t_matrix m, limit, p;
+    ok = ok && createMatrixFromGraph(r, &m) == 1;
+    freeGraph(&r);
+    if (ok) {
+        start = benchNow();
+        ok = computeConvergedMatrixPower(m, 1e-9, &limit, 2000) == -1;
+        double detect_time = benchNow() - start;
+        p = createMatrix(ring, ring);
+        start = benchNow();
+        for (int k = 0; k < products && isValidMatrix(p); k++) multiplyMatricesInto(m, m, p);
+        double product_time = (benchNow() - start) / products;
+        printf("  period-2 ring of %d states : detected in %8.4f s, 2000 products would take ~%.2f s\n",
+               ring, detect_time, 2000 * product_time);
+        freeMatrix(&p);
+        freeMatrix(&m);
+    }
+
+    // Classe apériodique (anneau + raccourcis aléatoires) : POWER choisi d'après la période contre LAZY
+    g = createArenaGraph(solved);
+    for (int v = 1; v <= solved; v++) {
+        int shortcut = 1 + (int)(benchRandom() % (unsigned int)solved);
+        addEdge(&g, v, v % solved + 1, 0.5);
+        addEdge(&g, v, (shortcut == v % solved + 1) ? v : shortcut, 0.5);
+    }
+    t_sparse_matrix sparse;
+    double *pi = malloc((size_t)solved * sizeof(double));
+    ok = ok && pi != NULL && createSparseMatrixFromGraph(g, &sparse) == 1;
+    freeGraph(&g);
+    if (ok) {
+        int period = computeStationaryPeriod(sparse);
+        start = benchNow();
+        int lazy_iter = computeStationaryDistribution(sparse, STATIONARY_LAZY, STATIONARY_DEFAULT_TOLERANCE,
+                                                      STATIONARY_MAX_ITERATIONS, pi);
+        double lazy_time = benchNow() - start;
+        start = benchNow();
+        int chosen_iter = computeStationaryDistribution(sparse, chooseStationaryMethod(period),
+                                                        STATIONARY_DEFAULT_TOLERANCE, STATIONARY_MAX_ITERATIONS, pi);
+        double chosen_time = benchNow() - start;
+        printf("  %d states, period %d : lazy %5d it %8.4f s, chosen method %5d it %8.4f s\n",
+               solved, period, lazy_iter, lazy_time, chosen_iter, chosen_time);
+        ok = lazy_iter >= 0 && chosen_iter >= 0;
+        freeSparseMatrix(&sparse);
+    }
+    free(pi);
+    return ok ? 0 : 1;
+}
+
+// Temps d'atteinte : contexte reconstruit pour chaque ensemble vs contexte partagé vs lot multithread
+static int bench_hitting_times(void) {
+    const int vertices = 5000, degree = 4, sets = 8, per_set = 50;
+    t_graph g = createBenchChain(vertices, degree);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_partition *partition = tarjanCsr(csr);
+    int *targets = malloc((size_t)sets * per_set * sizeof(int));
+    int *counts = malloc((size_t)sets * sizeof(int));
+    const int **target_sets = malloc((size_t)sets * sizeof(int *));
+    double **times = calloc((size_t)sets, sizeof(double *));
+    double **batch = calloc((size_t)sets, sizeof(double *));
+    int ok = partition != NULL && targets != NULL && counts != NULL && target_sets != NULL &&
+             times != NULL && batch != NULL;
+    for (int s = 0; ok && s < sets; s++) {
+        for (int t = 0; t < per_set; t++) targets[s * per_set + t] = 1 + (int)(benchRandom() % (unsigned int)vertices);
+        counts[s] = per_set;
+        target_sets[s] = targets + s * per_set;
+        times[s] = malloc((size_t)vertices * sizeof(double));
+        batch[s] = malloc((size_t)vertices * sizeof(double));
+        ok = times[s] != NULL && batch[s] != NULL;
+    }
+
+    t_hitting_context ctx;
+    double start = benchNow();
+    for (int s = 0; ok && s < sets; s++) {
+        ok = createHittingContext(csr, partition, &ctx) == 1;
+        if (!ok) break;
+        ok = computeHittingTimes(&ctx, target_sets[s], per_set, HITTING_DEFAULT_TOLERANCE, times[s]) == 1;
+        freeHittingContext(&ctx);
+    }
+    double rebuilt_time = benchNow() - start;
+
+    start = benchNow();
+    int has_context = ok && createHittingContext(csr, partition, &ctx) == 1;
+    double context_time = benchNow() - start;
+    ok = has_context;
+    for (int s = 0; ok && s < sets; s++) {
+        ok = computeHittingTimes(&ctx, target_sets[s], per_set, HITTING_DEFAULT_TOLERANCE, times[s]) == 1;
+    }
+    double shared_time = benchNow() - start;
+
+    start = benchNow();
+    ok = ok && computeHittingTimesBatch(&ctx, target_sets, counts, sets, HITTING_DEFAULT_TOLERANCE, 0, batch) == 1;
+    double batch_time = benchNow() - start;
+    for (int s = 0; ok && s < sets; s++) {
+        ok = memcmp(times[s], batch[s], (size_t)vertices * sizeof(double)) == 0;
+    }
+
+    printf("  %d states, %d sets of %d targets (context alone: %.4f s)\n", vertices, sets, per_set, context_time);
+    printf("  context rebuilt for each set : %8.4f s\n", rebuilt_time);
+    printf("  shared context               : %8.4f s\n", shared_time);
+    printf("  batch, %d thread(s)           : %8.4f s (%s)\n", resolveThreadCount(0), batch_time,
+           ok ? "identical" : "MISMATCH");
+
+    if (has_context) freeHittingContext(&ctx);
+    for (int s = 0; times != NULL && batch != NULL && s < sets; s++) {
+        free(times[s]);
+        free(batch[s]);
+    }
+    free(targets);
+    free(counts);
+    free(target_sets);
+    free(times);
+    free(batch);
+    freePartition(partition);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return ok ? 0 : 1;
+}
+
+// Marches aléatoires : tirage par table d'alias vs parcours cumulatif des arêtes
+static int bench_simulation(void) {
+    const int vertices = 100000, degree = 32, steps = 100;
+    const long long walkers = 100000;
+    t_graph g = createBenchChain(vertices, degree);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_walk_sampler sampler = createEmptyWalkSampler();
+    t_simulation simulation = createEmptySimulation();
+
+    double start = benchNow();
+    int ok = createWalkSampler(g, &sampler) == 1;
+    double build_time = benchNow() - start;
+    start = benchNow();
+    ok = ok && simulateRandomWalks(&sampler, 1, walkers, steps, 7, &simulation) == 1;
+    double alias_time = benchNow() - start;
+
+    // Référence : somme cumulée des poids jusqu'à dépasser u, O(degré) par pas
+    long long *counts = calloc((size_t)vertices, sizeof(long long));
+    start = benchNow();
+    for (long long w = 0; ok && counts != NULL && w < walkers; w++) {
+        int state = 0;
+        for (int t = 0; t < steps; t++) {
+            double u = (double)benchRandom() / 16777216.0, sum = 0.0;
+            int e = csr.offsets[state], last = csr.offsets[state + 1] - 1;
+            while (e < last && (sum += csr.weights[e]) <= u) e++;
+            state = csr.targets[e] - 1;
+        }
+        counts[state]++;
+    }
+    double scan_time = benchNow() - start;
+
+    double samples = (double)walkers * steps;
+    printf("  %d states, %d edges per state, %lld walkers x %d steps\n", vertices, degree, walkers, steps);
+    printf("  alias tables built in %8.4f s\n", build_time);
+    printf("  alias sampling  : %8.4f s (%.1f M steps/s)\n", alias_time, samples / alias_time / 1e6);
+    printf("  cumulative scan : %8.4f s (%.1f M steps/s)\n", scan_time, samples / scan_time / 1e6);
+
+    free(counts);
+    freeSimulation(&simulation);
+    freeWalkSampler(&sampler);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return ok ? 0 : 1;
+}
+
+// Simulation parallèle : un thread vs pool, histogrammes identiques au bit près
+static int bench_simulation_threads(void) {
+    const int vertices = 1000000, degree = 4, steps = 50;
+    const long long walkers = 200000;
+    t_graph g = createBenchChain(vertices, degree);
+    t_walk_sampler sampler = createEmptyWalkSampler();
+    t_simulation single = createEmptySimulation(), parallel = createEmptySimulation();
+    int ok = createWalkSampler(g, &sampler) == 1;
+    freeGraph(&g);
+
+    double start = benchNow();
+    ok = ok && simulateRandomWalksParallel(&sampler, 1, walkers, steps, 99, 1, &single) == 1;
+    double single_time = benchNow() - start;
+    start = benchNow();
+    ok = ok && simulateRandomWalksParallel(&sampler, 1, walkers, steps, 99, 0, &parallel) == 1;
+    double parallel_time = benchNow() - start;
+    int identical = ok &&
+                    memcmp(single.occupancy, parallel.occupancy, (size_t)vertices * sizeof(long long)) == 0 &&
+                    memcmp(single.final_counts, parallel.final_counts, (size_t)vertices * sizeof(long long)) == 0;
+
+    double samples = (double)walkers * steps;
+    printf("  %d states, %lld walkers x %d steps (Philox4x32-10 per walker)\n", vertices, walkers, steps);
+    printf("  1 thread     : %8.4f s (%.1f M steps/s)\n", single_time, samples / single_time / 1e6);
+    printf("  %d thread(s) : %8.4f s (%.1f M steps/s, identical: %s)\n", resolveThreadCount(0), parallel_time,
+           samples / parallel_time / 1e6, identical ? "yes" : "no");
+
+    freeSimulation(&single);
+    freeSimulation(&parallel);
+    freeWalkSampler(&sampler);
+    return identical ? 0 : 1;
+}
+
+void register_project_benchmarks(void) {
+    add_bench("graph_import", bench_graph_import, "Chargement texte : fscanf vs tokenizer vs mmap vs parallèle");
+    add_bench("graph_binary_import", bench_graph_binary_import, "Chargement binaire vs texte");
+    add_bench("matrix_multiply", bench_matrix_multiply, "Produit matriciel : triple boucle sur lignes séparées vs produit par blocs");
+    add_bench("matrix_multiply_kernels", bench_matrix_multiply_kernels, "GFLOP/s du produit par blocs par noyau");
+    add_bench("matrix_power", bench_matrix_power, "Puissance : produits successifs vs exponentiation rapide");
+    add_bench("converged_power", bench_converged_power, "Convergence de M^n : recalcul vs incrémental vs doublement");
+    add_bench("distribution_steps", bench_distribution_steps, "Distribution après n pas : M^n vs vecteur vs CSR");
+    add_bench("sparse_matrix", bench_sparse_matrix, "Matrice creuse vs dense : mémoire, distribution et produits");
+    add_bench("stationary_distribution", bench_stationary_distribution, "Distribution stationnaire : M^n convergée vs itérations vectorielles");
+    add_bench("stationary_solvers", bench_stationary_solvers, "Distribution stationnaire : M^n vs GTH vs LU vs itérations");
+    add_bench("stationary_classes", bench_stationary_classes, "Distributions stationnaires par classe : séquentiel vs pool de threads");
+    add_bench("tarjan", bench_tarjan, "Tarjan récursif vs itératif, chaîne de 10 millions d'états");
+    add_bench("scc_engines", bench_scc_engines, "Composantes fortement connexes : Tarjan vs moteur parallèle");
+    add_bench("hasse_links", bench_hasse_links, "Liens entre classes : addLink vs DAG de condensation");
+    add_bench("transitive_reduction", bench_transitive_reduction, "Réduction transitive : boucles imbriquées vs bitsets");
+    add_bench("class_degrees", bench_class_degrees, "Classes persistantes et états absorbants : parcours des liens vs degrés précalculés");
+    add_bench("absorption", bench_absorption, "Probabilités et temps d'absorption de 120 000 états transitoires");
+    add_bench("class_periods", bench_class_periods, "Périodes des classes : détection des classes périodiques et choix de l'itération");
+    add_bench("hitting_times", bench_hitting_times, "Temps moyens d'atteinte de 8 ensembles de cibles : contexte partagé et lot multithread");
+    add_bench("simulation", bench_simulation, "Marches aléatoires : table d'alias vs parcours cumulatif");
+    add_bench("simulation_threads", bench_simulation_threads, "Simulation reproductible : un thread vs pool de threads");
+}
@@ -0,0 +1,59 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/**
+ * @file bench.h
+ * @brief Framework API for performance benchmarks registration and execution.
+ */
+
+/**
+ * @brief Function pointer type for benchmark functions.
+ *
+ * Benchmark functions take no parameters and print their own measurements.
+ * They return 0 on success, non-zero if the benchmark could not run or if
+ * the compared implementations disagree.
+ */
+typedef int (*bench_fn)(void);
+
+/**
+ * @brief Represents a registered benchmark entry.
+ *
+ * @param name Human-readable name of the benchmark.
+ * @param fn Function pointer to the benchmark function.
+ * @param comment Optional short description of the benchmark.
+ */
+typedef struct {
+    const char *name;
+    bench_fn fn;
+    const char *comment;
+} bench_entry;
+
+/**
+ * @brief Register a benchmark in the global benchmark registry.
+ *
+ * @param name Human-readable name of the benchmark (must be a valid C string).
+ * @param fn Pointer to the benchmark function (must conform to bench_fn).
+ * @param comment Optional short description of the benchmark (may be NULL).
+ */
+void add_bench(const char *name, bench_fn fn, const char *comment);
+
+/**
+ * @brief Execute all registered benchmarks and print their measurements.
+ *
+ * @return Number of failed benchmarks (0 indicates all benchmarks ran).
+ */
+int run_all_benchmarks(void);
+
+/**
+ * @brief Register built-in project benchmarks into the global registry.
+ */
+void register_project_benchmarks(void);
+
+/**
+ * @brief Current time of a monotonic-enough wall clock.
+ *
+ * @return Time in seconds, only meaningful as a difference between two calls.
+ */
+double benchNow(void);
+
+#endif // BENCH_H
@@ -27,3 +27,53 @@ int freeCell(t_cell* cell) {
     free(cell);
     return 1;
 }
+
+t_cell_arena* createCellArena(void) {
+    t_cell_arena *arena = (t_cell_arena *)malloc(sizeof(t_cell_arena));
+    if (arena == NULL) {
+        fprintf(stderr, "createCellArena: memory allocation failed\n");
+        return NULL;
+    }
+    arena->chunks = NULL;
+    arena->chunk_count = 0;
+    return arena;
+}
+
+t_cell* createArenaCell(t_cell_arena* arena, int vertex, double weight) {
+    if (arena == NULL) {
+        fprintf(stderr, "createArenaCell: arena pointer is NULL\n");
+        return NULL;
+    }
+    // Start a new chunk when the current one is full
+    if (arena->chunks == NULL || arena->chunks->used >= CELL_ARENA_CHUNK_SIZE) {
+        t_cell_chunk *chunk = (t_cell_chunk *)malloc(sizeof(t_cell_chunk));
+        if (chunk == NULL) {
+            fprintf(stderr, "createArenaCell: memory allocation failed\n");
+            return NULL;
+        }
+        chunk->used = 0;
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+        arena->chunk_count++;
+    }
+    t_cell *cell = &arena->chunks->cells[arena->chunks->used++];
+    cell->vertex = vertex;
+    cell->weight = weight;
+    cell->next = NULL;
+    return cell;
+}
+
+int freeCellArena(t_cell_arena* arena) {
+    if (arena == NULL) {
+        fprintf(stderr, "freeCellArena: arena pointer is NULL\n");
+        return -1;
+    }
+    t_cell_chunk *curr = arena->chunks;
+    while (curr != NULL) {
+        t_cell_chunk *next = curr->next;
+        free(curr);
+        curr = next;
+    }
+    free(arena);
+    return 1;
+}
@@ -20,6 +20,36 @@ struct s_cell {
 };
 typedef struct s_cell t_cell;
 
+#define CELL_ARENA_CHUNK_SIZE 4096
+
+/**
+ * @struct s_cell_chunk
+ * @brief Block of cells allocated at once by a cell arena
+ * @param cells Storage for CELL_ARENA_CHUNK_SIZE cells
+ * @param used Number of cells already handed out from this chunk
+ * @param next Pointer to the previously allocated chunk
+ */
+struct s_cell_chunk {
+    t_cell cells[CELL_ARENA_CHUNK_SIZE];
+    int used;
+    struct s_cell_chunk* next;
+};
+typedef struct s_cell_chunk t_cell_chunk;
+
+/**
+ * @struct s_cell_arena
+ * @brief Slab allocator owning every cell it hands out
+ * @param chunks Pointer to the most recently allocated chunk
+ * @param chunk_count Number of chunks owned by the arena
+ * @note Cells obtained from an arena must never be released with freeCell():
+ *       they are all released at once by freeCellArena().
+ */
+struct s_cell_arena {
+    t_cell_chunk* chunks;
+    int chunk_count;
+};
+typedef struct s_cell_arena t_cell_arena;
+
 /**
  * @brief Creates a new cell with specified vertex and weight
  * @param vertex The vertex identifier
@@ -41,4 +71,26 @@ void displayCell(t_cell cell);
  */
 int freeCell(t_cell* cell);
 
+/**
+ * @brief Creates an empty cell arena
+ * @return Pointer to the newly created arena, or NULL on allocation failure
+ */
+t_cell_arena* createCellArena(void);
+
+/**
+ * @brief Creates a new cell with specified vertex and weight inside an arena
+ * @param arena The arena owning the cell
+ * @param vertex The vertex identifier
+ * @param weight The weight value
+ * @return Pointer to the newly created cell, or NULL on failure
+ */
+t_cell* createArenaCell(t_cell_arena* arena, int vertex, double weight);
+
+/**
+ * @brief Frees an arena and every cell allocated from it, one chunk at a time
+ * @param arena Pointer to the arena to free
+ * @return 1 on success, -1 if arena is NULL
+ */
+int freeCellArena(t_cell_arena* arena);
+
 #endif //CELL_H
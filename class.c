@@ -13,6 +13,7 @@ t_class* createClass(int class_id) {
     class->id = class_id;
     class->vertices = NULL;
     class->vertex_number = 0;
+    class->period = 0;
     class->next = NULL;
     return class;
 }
@@ -70,9 +71,12 @@ void displayClass(t_class *class) {
 }
 
 void freeVertices(t_vertex *vertex) {
-    if (vertex == NULL) return;
-    freeVertices(vertex->next);
-    free(vertex);
+    // Boucle plutôt que récursion : une classe peut contenir des millions de sommets
+    while (vertex != NULL) {
+        t_vertex *next = vertex->next;
+        free(vertex);
+        vertex = next;
+    }
 }
 
 int freeClass(t_class *class) {
@@ -22,12 +22,15 @@ typedef struct s_vertex {
  * @brief Represents a class containing a list of vertices
  * @param id The class identifier
  * @param vertices Pointer to the first vertex in the class
+ * @param period Period of the class (gcd of its cycle lengths), see computeClassPeriods();
+ *        0 while unknown or when the class has no cycle (single state without loop)
  * @param next Pointer to the next class in the list
  */
 typedef struct s_class {
     int id;
     t_vertex *vertices;
     int vertex_number;
+    int period;
     struct s_class *next;
 } t_class;
 
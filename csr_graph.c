@@ -0,0 +1,232 @@
+#include "csr_graph.h"
+#include "graph_reader.h"
+
+/* Private helper functions ============================================ */
+
+/**
+ * @brief Allocates the arrays of a CSR graph with given dimensions.
+ * @param size Number of vertices.
+ * @param edge_count Number of edges.
+ * @return The allocated CSR graph (offsets zeroed), or an empty CSR graph on failure.
+ */
+static t_csr_graph allocateCsrGraph(int size, int edge_count) {
+    t_csr_graph csr = createEmptyCsrGraph();
+
+    csr.offsets = calloc((size_t)size + 1, sizeof *csr.offsets);
+    // malloc(0) may return NULL: always allocate at least one edge slot
+    csr.targets = malloc(((size_t)edge_count + 1) * sizeof *csr.targets);
+    csr.weights = malloc(((size_t)edge_count + 1) * sizeof *csr.weights);
+    if (csr.offsets == NULL || csr.targets == NULL || csr.weights == NULL) {
+        perror("allocateCsrGraph: allocation failed");
+        freeCsrGraph(&csr);
+        return createEmptyCsrGraph();
+    }
+
+    csr.size = size;
+    csr.edge_count = edge_count;
+    return csr;
+}
+
+/* Public functions ==================================================== */
+
+t_csr_graph createEmptyCsrGraph(void) {
+    t_csr_graph csr = { .size = 0, .edge_count = 0, .offsets = NULL, .targets = NULL, .weights = NULL,
+                        .mapping = { .data = NULL, .size = 0, .fd = -1 } };
+    return csr;
+}
+
+t_csr_graph createCsrGraphFromGraph(t_graph graph) {
+    if (graph.values == NULL || graph.size < MIN_SIZE_GRAPH) {
+        fprintf(stderr, "createCsrGraphFromGraph: graph is not initialized\n");
+        return createEmptyCsrGraph();
+    }
+
+    // Count edges to size the arrays
+    int edge_count = 0;
+    for (int i = 0; i < graph.size; i++) {
+        for (t_cell *cur = graph.values[i].head; cur != NULL; cur = cur->next) {
+            edge_count++;
+        }
+    }
+
+    t_csr_graph csr = allocateCsrGraph(graph.size, edge_count);
+    if (isEmptyCsrGraph(csr)) return csr;
+
+    // Copy each adjacency list, keeping the list order
+    int pos = 0;
+    for (int i = 0; i < graph.size; i++) {
+        csr.offsets[i] = pos;
+        for (t_cell *cur = graph.values[i].head; cur != NULL; cur = cur->next) {
+            csr.targets[pos] = cur->vertex;
+            csr.weights[pos] = cur->weight;
+            pos++;
+        }
+    }
+    csr.offsets[graph.size] = pos;
+
+    return csr;
+}
+
+t_csr_graph transposeCsrGraph(t_csr_graph graph) {
+    if (isEmptyCsrGraph(graph)) {
+        fprintf(stderr, "transposeCsrGraph: graph is not initialized\n");
+        return createEmptyCsrGraph();
+    }
+    t_csr_graph reverse = allocateCsrGraph(graph.size, graph.edge_count);
+    if (isEmptyCsrGraph(reverse)) return reverse;
+
+    // Comptage des arêtes entrantes (offsets mis à zéro), puis remplissage dans l'ordre des sources
+    for (int e = 0; e < graph.edge_count; e++) reverse.offsets[graph.targets[e]]++;
+    for (int v = 0; v < graph.size; v++) reverse.offsets[v + 1] += reverse.offsets[v];
+    for (int v = 0; v < graph.size; v++) {
+        for (int e = graph.offsets[v]; e < graph.offsets[v + 1]; e++) {
+            int pos = reverse.offsets[graph.targets[e] - 1]++;
+            reverse.targets[pos] = v + 1;
+            reverse.weights[pos] = graph.weights[e];
+        }
+    }
+    // Chaque offsets[v] pointe maintenant sur le début de la ligne v + 1 : décalage d'un cran
+    for (int v = graph.size; v > 0; v--) reverse.offsets[v] = reverse.offsets[v - 1];
+    reverse.offsets[0] = 0;
+    return reverse;
+}
+
+t_csr_graph createCsrGraphFromEdgeBuffers(int size, const t_edge_buffer *buffers, int buffer_count,
+                                          const char *caller) {
+    if (size < MIN_SIZE_GRAPH) {
+        fprintf(stderr, "createCsrGraphFromEdgeBuffers: size must be >= %d (got %d)\n", MIN_SIZE_GRAPH, size);
+        return createEmptyCsrGraph();
+    }
+
+    // Drop invalid edges (in file order) while counting valid ones
+    int edge_count = 0;
+    for (int b = 0; b < buffer_count; b++) {
+        for (int e = 0; e < buffers[b].count; e++) {
+            int src = buffers[b].srcs[e], dest = buffers[b].dests[e];
+            if (src < 1 || src > size || dest < 1 || dest > size) {
+                fprintf(stderr, "%s: edge with invalid vertices (%d -> %d) ignored\n", caller, src, dest);
+                continue;
+            }
+            edge_count++;
+        }
+    }
+
+    t_csr_graph csr = allocateCsrGraph(size, edge_count);
+    if (isEmptyCsrGraph(csr)) return csr;
+
+    int *fill = malloc((size_t)size * sizeof *fill);
+    if (fill == NULL) {
+        perror("createCsrGraphFromEdgeBuffers: allocation failed");
+        freeCsrGraph(&csr);
+        return csr;
+    }
+
+    // Count the out-degree of each vertex, then turn counts into offsets
+    for (int b = 0; b < buffer_count; b++) {
+        for (int e = 0; e < buffers[b].count; e++) {
+            int src = buffers[b].srcs[e], dest = buffers[b].dests[e];
+            if (src < 1 || src > size || dest < 1 || dest > size) continue;
+            csr.offsets[src]++;
+        }
+    }
+    for (int v = 0; v < size; v++) {
+        csr.offsets[v + 1] += csr.offsets[v];
+        fill[v] = csr.offsets[v + 1];
+    }
+
+    // Fill each row from its end: an adjacency list stores the last
+    // inserted edge first, so the file order is reversed within a row
+    for (int b = 0; b < buffer_count; b++) {
+        for (int e = 0; e < buffers[b].count; e++) {
+            int src = buffers[b].srcs[e], dest = buffers[b].dests[e];
+            if (src < 1 || src > size || dest < 1 || dest > size) continue;
+            int pos = --fill[src - 1];
+            csr.targets[pos] = dest;
+            csr.weights[pos] = buffers[b].weights[e];
+        }
+    }
+    free(fill);
+
+    return csr;
+}
+
+t_csr_graph importCsrGraphFromFile(const char *path) {
+    FILE *file = fopen(path, "rt");
+    int nbvert, src, dest;
+    double weight;
+    t_graph_reader reader;
+
+    if (file == NULL) {
+        fprintf(stderr, "importCsrGraphFromFile: could not open file '%s'\n", path);
+        return createEmptyCsrGraph();
+    }
+    if (openGraphReader(&reader, file) < 0) {
+        fclose(file);
+        return createEmptyCsrGraph();
+    }
+
+    if (!readGraphInt(&reader, &nbvert)) {
+        fprintf(stderr, "importCsrGraphFromFile: could not read number of vertices from '%s'\n", path);
+        closeGraphReader(&reader);
+        fclose(file);
+        return createEmptyCsrGraph();
+    }
+
+    if (nbvert < MIN_SIZE_GRAPH) {
+        fprintf(stderr, "importCsrGraphFromFile: invalid number of vertices (%d) in '%s'\n", nbvert, path);
+        closeGraphReader(&reader);
+        fclose(file);
+        return createEmptyCsrGraph();
+    }
+
+    t_edge_buffer edges = createEdgeBuffer();
+    int status = 1;
+    while (status > 0 && readGraphEdge(&reader, &src, &dest, &weight)) {
+        status = appendEdgeToBuffer(&edges, src, dest, weight);
+    }
+    closeGraphReader(&reader);
+    fclose(file);
+
+    t_csr_graph csr = createEmptyCsrGraph();
+    if (status > 0) {
+        csr = createCsrGraphFromEdgeBuffers(nbvert, &edges, 1, "importCsrGraphFromFile");
+    }
+    freeEdgeBuffer(&edges);
+    return csr;
+}
+
+int getCsrOutDegree(t_csr_graph graph, int src) {
+    if (graph.offsets == NULL || src < 1 || src > graph.size) return 0;
+    return graph.offsets[src] - graph.offsets[src - 1];
+}
+
+int isEmptyCsrGraph(t_csr_graph graph) {
+    return graph.offsets == NULL;
+}
+
+void displayCsrGraph(t_csr_graph graph) {
+    for (int i = 0; i < graph.size; i++) {
+        printf("List of vertex %d: [head]", i + 1);
+        for (int e = graph.offsets[i]; e < graph.offsets[i + 1]; e++) {
+            printf("@->(%d, %.2f)", graph.targets[e], graph.weights[e]);
+        }
+        printf("\n");
+    }
+}
+
+int freeCsrGraph(t_csr_graph *graph) {
+    if (graph == NULL) {
+        fprintf(stderr, "freeCsrGraph: graph pointer is NULL\n");
+        return -1;
+    }
+    if (graph->mapping.data != NULL) {
+        // The arrays live inside the mapped file
+        unmapGraphFile(&graph->mapping);
+    } else {
+        free(graph->offsets);
+        free(graph->targets);
+        free(graph->weights);
+    }
+    *graph = createEmptyCsrGraph();
+    return 1;
+}
@@ -0,0 +1,109 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include "graph.h"
+#include "graph_reader.h"
+
+/**
+ * @file csr_graph.h
+ * @brief Frozen compressed sparse row (CSR) representation of a directed weighted graph
+ */
+
+/**
+ * @struct s_csr_graph
+ * @brief Read-only graph stored as three contiguous arrays
+ * @param size Number of vertices in the graph
+ * @param edge_count Number of edges in the graph
+ * @param offsets Array of size + 1 entries: the edges of vertex v (1-indexed)
+ *        are stored at indices [offsets[v - 1], offsets[v]) of targets and weights
+ * @param targets Destination vertex of each edge (1-indexed)
+ * @param weights Weight of each edge
+ * @param mapping File mapping holding the three arrays when the graph was
+ *        loaded with importCsrGraphFromBinaryFile(), or an empty mapping
+ *        when the arrays are allocated on the heap
+ * @note Edges of a vertex are stored in the same order as they appear in the
+ *       adjacency list of the equivalent t_graph, so traversals visit
+ *       neighbors in the same order on both representations.
+ */
+struct s_csr_graph {
+    int size;
+    int edge_count;
+    int *offsets;
+    int *targets;
+    double *weights;
+    t_mapped_file mapping;
+};
+typedef struct s_csr_graph t_csr_graph;
+
+/**
+ * @brief Creates an empty CSR graph with size 0 and NULL arrays
+ * @return An empty CSR graph structure
+ */
+t_csr_graph createEmptyCsrGraph(void);
+
+/**
+ * @brief Builds a CSR graph from an adjacency list graph
+ * @param graph The graph to freeze
+ * @return The CSR graph, or an empty CSR graph on failure
+ */
+t_csr_graph createCsrGraphFromGraph(t_graph graph);
+
+/**
+ * @brief Imports a CSR graph directly from a file, without building adjacency lists
+ * @param path Path to the file containing the graph data
+ * @return The imported CSR graph, or an empty CSR graph on failure
+ * @note Same file format as importGraphFromFile()
+ */
+t_csr_graph importCsrGraphFromFile(const char *path);
+
+/**
+ * @brief Builds a CSR graph from edges parsed in file order
+ * @param size Number of vertices
+ * @param buffers Edge buffers, in file order
+ * @param buffer_count Number of edge buffers
+ * @param caller Name of the loader, used in the messages about invalid edges
+ * @return The CSR graph, or an empty CSR graph on failure
+ * @note Edges with out-of-range vertices are reported and ignored, like in
+ *       importGraphFromFile()
+ */
+t_csr_graph createCsrGraphFromEdgeBuffers(int size, const t_edge_buffer *buffers, int buffer_count,
+                                          const char *caller);
+
+/**
+ * @brief Gets the number of outgoing edges of a vertex
+ * @param graph The CSR graph
+ * @param src Source vertex (1-indexed)
+ * @return The out-degree of src, or 0 if src is out of range
+ */
+int getCsrOutDegree(t_csr_graph graph, int src);
+
+/**
+ * @brief Checks if a CSR graph is empty (uninitialized)
+ * @param graph The CSR graph to inspect
+ * @return 1 if empty, 0 otherwise
+ */
+int isEmptyCsrGraph(t_csr_graph graph);
+
+/**
+ * @brief Creates the reverse of a CSR graph: edge v -> u of weight w for each edge u -> v
+ * @param graph The CSR graph
+ * @return The reverse graph, incoming edges of each vertex in increasing source order,
+ *         or an empty graph on error. Caller must free with freeCsrGraph().
+ */
+t_csr_graph transposeCsrGraph(t_csr_graph graph);
+
+/**
+ * @brief Displays the entire CSR graph (one line per vertex)
+ * @param graph The CSR graph to display
+ */
+void displayCsrGraph(t_csr_graph graph);
+
+/**
+ * @brief Frees all memory allocated for the CSR graph
+ * @param graph Pointer to the CSR graph to free
+ * @note A graph backed by a file mapping is unmapped instead
+ * @return 1 on success, -1 on failure
+ */
+int freeCsrGraph(t_csr_graph *graph);
+
+#endif //CSR_GRAPH_H
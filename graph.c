@@ -1,8 +1,10 @@
 #include "graph.h"
+#include <string.h>
+#include "graph_reader.h"
 
 // Crée un graphe vide de la taille 0 et de valeurs NULL
 t_graph createEmptyGraph(void) {
-    t_graph graph = { .values = NULL, .size = 0 };
+    t_graph graph = { .values = NULL, .size = 0, .arena = NULL };
     return graph;
 }
 
@@ -29,6 +31,20 @@ t_graph createGraph(int size) {
     return graph;
 }
 
+// Crée un graphe vide de la taille donnée dont les cellules viennent d'une arène
+t_graph createArenaGraph(int size) {
+    t_graph graph = createGraph(size);
+    if (graph.values == NULL) return graph;
+
+    graph.arena = createCellArena();
+    if (graph.arena == NULL) {
+        fprintf(stderr, "createArenaGraph: failed to create cell arena\n");
+        freeGraph(&graph);
+        return createEmptyGraph();
+    }
+    return graph;
+}
+
 // Affiche le graphe
 void displayGraph(t_graph graph) {
     for (int i = 0; i < graph.size; i++) {
@@ -56,8 +72,10 @@ int addEdge(t_graph *graph, int src, int dest, double weight) {
         return -1;
     }
     // addCell expects a t_list* for the source vertex
-    addCell(&graph->values[src - 1], dest, weight);
-    return 1;
+    if (graph->arena != NULL) {
+        return addArenaCell(&graph->values[src - 1], graph->arena, dest, weight);
+    }
+    return addCell(&graph->values[src - 1], dest, weight);
 }
 
 // Retourne la liste des voisins du sommet src (ou NULL en cas d'erreur)
@@ -91,6 +109,21 @@ int hasEdge(t_graph graph, int src, int dest) {
     return 0;
 }
 
+// Compare deux graphes arête par arête (même ordre dans les listes)
+int isSameGraph(t_graph a, t_graph b) {
+    if (a.size != b.size) return 0;
+    for (int i = 0; i < a.size; i++) {
+        t_cell *ca = a.values[i].head, *cb = b.values[i].head;
+        while (ca != NULL && cb != NULL) {
+            if (ca->vertex != cb->vertex || ca->weight != cb->weight) return 0;
+            ca = ca->next;
+            cb = cb->next;
+        }
+        if (ca != NULL || cb != NULL) return 0;
+    }
+    return 1;
+}
+
 // Libère toute la mémoire associée au graphe
 int freeGraph(t_graph *graph) {
     if (graph == NULL) {
@@ -101,8 +134,14 @@ int freeGraph(t_graph *graph) {
         graph->size = 0;
         return -1;
     }
-    for (int i = 0; i < graph->size; ++i) {
-        freeList(&graph->values[i]);
+    if (graph->arena != NULL) {
+        // Les cellules appartiennent à l'arène : on libère les blocs d'un coup
+        freeCellArena(graph->arena);
+        graph->arena = NULL;
+    } else {
+        for (int i = 0; i < graph->size; ++i) {
+            freeList(&graph->values[i]);
+        }
     }
     free(graph->values);
     graph->values = NULL;
@@ -110,42 +149,134 @@ int freeGraph(t_graph *graph) {
     return 1;
 }
 
+// Lit un graphe depuis un lecteur déjà ouvert (flux bufferisé ou fichier projeté)
+static t_graph importGraphFromReader(t_graph_reader *reader, const char* path) {
+    int nbvert, src, dest;
+    double weight;
+    t_graph graph;
+
+    // first line contains number of vertices
+    if (!readGraphInt(reader, &nbvert)) {
+        fprintf(stderr, "importGraphFromFile: could not read number of vertices from '%s'\n", path);
+        return createEmptyGraph();
+    }
+
+    // valider le nombre de sommets lu
+    if (nbvert < 1) {
+        fprintf(stderr, "importGraphFromFile: invalid number of vertices (%d) in '%s'\n", nbvert, path);
+        return createEmptyGraph();
+    }
+
+    graph = createArenaGraph(nbvert);
+    if (graph.values == NULL) {
+        fprintf(stderr, "importGraphFromFile: failed to create graph\n");
+        return createEmptyGraph();
+    }
+
+    while (readGraphEdge(reader, &src, &dest, &weight)) {
+        if (src < 1 || src > graph.size || dest < 1 || dest > graph.size) {
+            fprintf(stderr, "importGraphFromFile: edge with invalid vertices (%d -> %d) ignored\n", src, dest);
+            continue;
+        }
+        addEdge(&graph, src, dest, weight);
+    }
+    return graph;
+}
+
+// Lit un graphe depuis un flux déjà ouvert
+static t_graph importGraphFromStream(FILE *file, const char* path) {
+    t_graph_reader reader;
+    if (openGraphReader(&reader, file) < 0) {
+        return createEmptyGraph();
+    }
+    t_graph graph = importGraphFromReader(&reader, path);
+    closeGraphReader(&reader);
+    return graph;
+}
+
 // Lit un graphe à partir d'un fichier
 t_graph importGraphFromFile(const char* path) {
+    FILE *file = fopen(path, "rt");
+    if (file == NULL) {
+        fprintf(stderr, "importGraphFromFile: could not open file '%s'\n", path);
+        return createEmptyGraph();
+    }
+    t_graph graph = importGraphFromStream(file, path);
+    fclose(file);
+    return graph;
+}
+
+// Lit un graphe en projetant le fichier en mémoire (flux bufferisé pour les pipes et stdin)
+t_graph importGraphFromMappedFile(const char* path) {
+    if (strcmp(path, GRAPH_STDIN_PATH) == 0) {
+        return importGraphFromStream(stdin, "<stdin>");
+    }
+
+    t_mapped_file mapped;
+    int status = mapGraphFile(path, GRAPH_MAP_PREFAULT, &mapped);
+    if (status < 0) {
+        fprintf(stderr, "importGraphFromMappedFile: could not open file '%s'\n", path);
+        return createEmptyGraph();
+    }
+    if (status == 0) {
+        // Pas un fichier régulier (pipe, FIFO, périphérique) : lecture en flux sur le
+        // descripteur déjà ouvert, rouvrir le chemin perdrait le contenu d'un pipe
+        FILE *file = fdopen(mapped.fd, "r");
+        if (file == NULL) {
+            perror("importGraphFromMappedFile: fdopen failed");
+            unmapGraphFile(&mapped);
+            return createEmptyGraph();
+        }
+        mapped.fd = -1;
+        t_graph graph = importGraphFromStream(file, path);
+        fclose(file);
+        return graph;
+    }
+
+    t_graph_reader reader;
+    openGraphReaderOnMemory(&reader, mapped.data, mapped.size);
+    t_graph graph = importGraphFromReader(&reader, path);
+    closeGraphReader(&reader);
+    unmapGraphFile(&mapped);
+    return graph;
+}
+
+// Lit un graphe à partir d'un fichier avec fscanf (chargeur de référence)
+t_graph importGraphFromFileWithScanf(const char* path) {
     FILE *file = fopen(path, "rt");
     int nbvert, src, dest;
     double weight;
     t_graph graph;
 
     if (file == NULL) {
-        fprintf(stderr, "importGraphFromFile: could not open file '%s'\n", path);
+        fprintf(stderr, "importGraphFromFileWithScanf: could not open file '%s'\n", path);
         return createEmptyGraph();
     }
 
     // first line contains number of vertices
     if (fscanf(file, "%d", &nbvert) != 1) {
-        fprintf(stderr, "importGraphFromFile: could not read number of vertices from '%s'\n", path);
+        fprintf(stderr, "importGraphFromFileWithScanf: could not read number of vertices from '%s'\n", path);
         fclose(file);
         return createEmptyGraph();
     }
 
     // valider le nombre de sommets lu
     if (nbvert < 1) {
-        fprintf(stderr, "importGraphFromFile: invalid number of vertices (%d) in '%s'\n", nbvert, path);
+        fprintf(stderr, "importGraphFromFileWithScanf: invalid number of vertices (%d) in '%s'\n", nbvert, path);
         fclose(file);
         return createEmptyGraph();
     }
 
-    graph = createGraph(nbvert);
+    graph = createArenaGraph(nbvert);
     if (graph.values == NULL) {
-        fprintf(stderr, "importGraphFromFile: failed to create graph\n");
+        fprintf(stderr, "importGraphFromFileWithScanf: failed to create graph\n");
         fclose(file);
         return createEmptyGraph();
     }
 
     while (fscanf(file, "%d %d %lf", &src, &dest, &weight) == 3) {
         if (src < 1 || src > graph.size || dest < 1 || dest > graph.size) {
-            fprintf(stderr, "importGraphFromFile: edge with invalid vertices (%d -> %d) ignored\n", src, dest);
+            fprintf(stderr, "importGraphFromFileWithScanf: edge with invalid vertices (%d -> %d) ignored\n", src, dest);
             continue;
         }
         addEdge(&graph, src, dest, weight);
@@ -8,19 +8,30 @@
 /**
  * @file graph.h
  * @brief Graph structure and operations for directed weighted graphs
+ *
+ * An edge src -> dest may appear several times (repeated line in a graph
+ * file): every engine sums the weights into a single transition
+ * probability, like isMarkovGraph() (dense and sparse matrices,
+ * propagation, stationary solvers, absorption, hitting times, simulation).
  */
 
 #define MIN_SIZE_GRAPH 1
 
+/** @brief Path understood as the standard input by importGraphFromMappedFile() */
+#define GRAPH_STDIN_PATH "-"
+
 /**
  * @struct s_graph
  * @brief Represents a directed weighted graph using adjacency lists
  * @param values Array of adjacency lists (one per vertex)
  * @param size Number of vertices in the graph
+ * @param arena Arena owning every cell of the graph, or NULL when each cell is
+ *        allocated individually
  */
 struct s_graph {
     t_list* values;
     int size;
+    t_cell_arena* arena;
 };
 typedef struct s_graph t_graph;
 
@@ -37,6 +48,15 @@ t_graph createEmptyGraph(void);
  */
 t_graph createGraph(int size);
 
+/**
+ * @brief Creates a graph whose cells are allocated in chunks from an arena
+ * @param size The number of vertices (must be >= MIN_SIZE_GRAPH)
+ * @return The created graph, or an empty graph on failure
+ * @note freeGraph() releases such a graph in O(number of chunks) instead of
+ *       O(number of edges)
+ */
+t_graph createArenaGraph(int size);
+
 /**
  * @brief Displays the entire graph (all adjacency lists)
  * @param graph The graph to display
@@ -62,6 +82,15 @@ int addEdge(t_graph *graph, int src, int dest, double weight);
  */
 int hasEdge(t_graph graph, int src, int dest);
 
+/**
+ * @brief Checks if two graphs have the same edges, in the same order in every adjacency list
+ * @param a First graph
+ * @param b Second graph
+ * @return 1 if the graphs are identical, 0 otherwise
+ * @note Used to check that every loader builds the same graph
+ */
+int isSameGraph(t_graph a, t_graph b);
+
 /**
  * @brief Gets the adjacency list (neighbors) of a vertex
  * @param graph Pointer to the graph
@@ -83,9 +112,29 @@ int freeGraph(t_graph *graph);
  * @return The imported graph, or an empty graph on failure
  * @note File format: first line contains number of vertices,
  *       following lines contain edges as "src dest weight"
+ * @note The imported graph is arena-backed (see createArenaGraph())
  */
 t_graph importGraphFromFile(const char* path);
 
+/**
+ * @brief Imports a graph by mapping the file in memory and parsing it in place
+ * @param path Path to the file containing the graph data, or GRAPH_STDIN_PATH
+ * @return The imported graph, or an empty graph on failure
+ * @note Same file format and result as importGraphFromFile(). Pipes, FIFOs
+ *       and the standard input cannot be mapped: they are read with the
+ *       buffered streaming reader instead
+ */
+t_graph importGraphFromMappedFile(const char* path);
+
+/**
+ * @brief Imports a graph from a file, reading every edge with fscanf
+ * @param path Path to the file containing the graph data
+ * @return The imported graph, or an empty graph on failure
+ * @note Reference implementation of importGraphFromFile(), kept to check and
+ *       benchmark the buffered tokenizer against it
+ */
+t_graph importGraphFromFileWithScanf(const char* path);
+
 /**
  * @brief Checks if a graph is a Markov graph
  * @param graph The graph to check
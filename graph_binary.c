@@ -0,0 +1,304 @@
+#include "graph_binary.h"
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include "graph_loader.h"
+#include "graph_reader.h"
+
+/* private functions =================================================== */
+
+/** @brief Number of values converted at once when the host is not little-endian. */
+#define BINARY_CONVERT_BLOCK 4096
+
+static int isLittleEndianHost(void) {
+    const uint16_t one = 1;
+    return *(const unsigned char *)&one == 1;
+}
+
+static void storeU32(unsigned char *p, uint32_t value) {
+    for (int i = 0; i < 4; i++) p[i] = (unsigned char)(value >> (8 * i));
+}
+
+static void storeU64(unsigned char *p, uint64_t value) {
+    for (int i = 0; i < 8; i++) p[i] = (unsigned char)(value >> (8 * i));
+}
+
+static uint32_t loadU32(const unsigned char *p) {
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; i--) value = (value << 8) | p[i];
+    return value;
+}
+
+static uint64_t loadU64(const unsigned char *p) {
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; i--) value = (value << 8) | p[i];
+    return value;
+}
+
+/**
+ * @brief Position of the targets array in a binary file.
+ * @param size Number of vertices.
+ * @return Offset in bytes from the start of the file.
+ */
+static size_t binaryTargetsPosition(size_t size) {
+    return GRAPH_BINARY_HEADER_SIZE + 4 * (size + 1);
+}
+
+/**
+ * @brief Position of the weights array in a binary file (aligned on 8 bytes).
+ * @param size Number of vertices.
+ * @param edge_count Number of edges.
+ * @return Offset in bytes from the start of the file.
+ */
+static size_t binaryWeightsPosition(size_t size, size_t edge_count) {
+    size_t end_of_targets = binaryTargetsPosition(size) + 4 * edge_count;
+    return (end_of_targets + 7) & ~(size_t)7;
+}
+
+/**
+ * @brief Writes int32 values in little-endian order.
+ * @param file Destination file.
+ * @param values Values to write.
+ * @param count Number of values.
+ * @return 1 on success, 0 on write error.
+ */
+static int writeInt32Array(FILE *file, const int *values, size_t count) {
+    if (isLittleEndianHost() && sizeof(int) == 4) {
+        return fwrite(values, 4, count, file) == count;
+    }
+    unsigned char block[4 * BINARY_CONVERT_BLOCK];
+    for (size_t done = 0; done < count; ) {
+        size_t n = (count - done < BINARY_CONVERT_BLOCK) ? count - done : BINARY_CONVERT_BLOCK;
+        for (size_t i = 0; i < n; i++) storeU32(block + 4 * i, (uint32_t)values[done + i]);
+        if (fwrite(block, 4, n, file) != n) return 0;
+        done += n;
+    }
+    return 1;
+}
+
+/**
+ * @brief Writes float64 values in little-endian order.
+ * @param file Destination file.
+ * @param values Values to write.
+ * @param count Number of values.
+ * @return 1 on success, 0 on write error.
+ */
+static int writeDoubleArray(FILE *file, const double *values, size_t count) {
+    if (isLittleEndianHost()) {
+        return fwrite(values, 8, count, file) == count;
+    }
+    unsigned char block[8 * BINARY_CONVERT_BLOCK];
+    for (size_t done = 0; done < count; ) {
+        size_t n = (count - done < BINARY_CONVERT_BLOCK) ? count - done : BINARY_CONVERT_BLOCK;
+        for (size_t i = 0; i < n; i++) {
+            uint64_t bits;
+            memcpy(&bits, &values[done + i], sizeof bits);
+            storeU64(block + 8 * i, bits);
+        }
+        if (fwrite(block, 8, n, file) != n) return 0;
+        done += n;
+    }
+    return 1;
+}
+
+/**
+ * @brief Checks the header of a mapped binary file against its size.
+ * @param mapped The mapped file.
+ * @param path Path of the file (for error messages).
+ * @param size Receives the number of vertices.
+ * @param edge_count Receives the number of edges.
+ * @return 1 if the header is valid, 0 otherwise (message already printed).
+ */
+static int readBinaryHeader(t_mapped_file mapped, const char *path, int *size, int *edge_count) {
+    const unsigned char *data = (const unsigned char *)mapped.data;
+
+    if (mapped.size < GRAPH_BINARY_HEADER_SIZE || memcmp(data, GRAPH_BINARY_MAGIC, 8) != 0) {
+        fprintf(stderr, "importCsrGraphFromBinaryFile: '%s' is not a binary graph file\n", path);
+        return 0;
+    }
+    uint32_t version = loadU32(data + 8);
+    if (version != GRAPH_BINARY_VERSION) {
+        fprintf(stderr, "importCsrGraphFromBinaryFile: unsupported format version %u in '%s'\n",
+                (unsigned)version, path);
+        return 0;
+    }
+    uint64_t vertices = loadU64(data + 16);
+    uint64_t edges = loadU64(data + 24);
+    if (vertices < MIN_SIZE_GRAPH || vertices >= INT_MAX || edges > INT_MAX) {
+        fprintf(stderr, "importCsrGraphFromBinaryFile: invalid dimensions in '%s'\n", path);
+        return 0;
+    }
+    if (mapped.size != binaryWeightsPosition((size_t)vertices, (size_t)edges) + 8 * (size_t)edges) {
+        fprintf(stderr, "importCsrGraphFromBinaryFile: '%s' is truncated or has trailing data\n", path);
+        return 0;
+    }
+    *size = (int)vertices;
+    *edge_count = (int)edges;
+    return 1;
+}
+
+/**
+ * @brief Copies the arrays of a mapped binary file, converting them to the host byte order.
+ * @param mapped The mapped file.
+ * @param csr CSR graph whose size and edge_count are set; receives the arrays.
+ * @return 1 on success, 0 on allocation failure.
+ */
+static int copyBinaryArrays(t_mapped_file mapped, t_csr_graph *csr) {
+    const unsigned char *data = (const unsigned char *)mapped.data;
+    const unsigned char *targets = data + binaryTargetsPosition((size_t)csr->size);
+    const unsigned char *weights = data + binaryWeightsPosition((size_t)csr->size, (size_t)csr->edge_count);
+
+    csr->offsets = malloc(((size_t)csr->size + 1) * sizeof *csr->offsets);
+    // malloc(0) may return NULL: always allocate at least one edge slot
+    csr->targets = malloc(((size_t)csr->edge_count + 1) * sizeof *csr->targets);
+    csr->weights = malloc(((size_t)csr->edge_count + 1) * sizeof *csr->weights);
+    if (csr->offsets == NULL || csr->targets == NULL || csr->weights == NULL) {
+        perror("importCsrGraphFromBinaryFile: allocation failed");
+        return 0;
+    }
+    for (int v = 0; v <= csr->size; v++) {
+        csr->offsets[v] = (int)loadU32(data + GRAPH_BINARY_HEADER_SIZE + 4 * (size_t)v);
+    }
+    for (int e = 0; e < csr->edge_count; e++) {
+        uint64_t bits = loadU64(weights + 8 * (size_t)e);
+        csr->targets[e] = (int)loadU32(targets + 4 * (size_t)e);
+        memcpy(&csr->weights[e], &bits, sizeof bits);
+    }
+    return 1;
+}
+
+/* public functions =================================================== */
+
+int exportCsrGraphToBinaryFile(t_csr_graph graph, const char *path) {
+    if (isEmptyCsrGraph(graph)) {
+        fprintf(stderr, "exportCsrGraphToBinaryFile: graph is not initialized\n");
+        return 0;
+    }
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "exportCsrGraphToBinaryFile: could not open file '%s'\n", path);
+        return 0;
+    }
+
+    unsigned char header[GRAPH_BINARY_HEADER_SIZE];
+    memcpy(header, GRAPH_BINARY_MAGIC, 8);
+    storeU32(header + 8, GRAPH_BINARY_VERSION);
+    storeU32(header + 12, 0);
+    storeU64(header + 16, (uint64_t)graph.size);
+    storeU64(header + 24, (uint64_t)graph.edge_count);
+
+    size_t end_of_targets = binaryTargetsPosition((size_t)graph.size) + 4 * (size_t)graph.edge_count;
+    size_t padding = binaryWeightsPosition((size_t)graph.size, (size_t)graph.edge_count) - end_of_targets;
+    static const unsigned char zeros[8] = { 0 };
+
+    int ok = fwrite(header, 1, sizeof header, file) == sizeof header
+             && writeInt32Array(file, graph.offsets, (size_t)graph.size + 1)
+             && writeInt32Array(file, graph.targets, (size_t)graph.edge_count)
+             && fwrite(zeros, 1, padding, file) == padding
+             && writeDoubleArray(file, graph.weights, (size_t)graph.edge_count);
+    if (fclose(file) != 0) ok = 0;
+
+    if (!ok) {
+        fprintf(stderr, "exportCsrGraphToBinaryFile: write error on '%s'\n", path);
+        remove(path);
+        return 0;
+    }
+    return 1;
+}
+
+int exportGraphToBinaryFile(t_graph graph, const char *path) {
+    t_csr_graph csr = createCsrGraphFromGraph(graph);
+    if (isEmptyCsrGraph(csr)) {
+        fprintf(stderr, "exportGraphToBinaryFile: could not freeze the graph\n");
+        return 0;
+    }
+    int result = exportCsrGraphToBinaryFile(csr, path);
+    freeCsrGraph(&csr);
+    return result;
+}
+
+t_csr_graph importCsrGraphFromBinaryFile(const char *path) {
+    t_mapped_file mapped;
+    int status = mapGraphFile(path, GRAPH_MAP_LAZY, &mapped);
+    if (status < 0) {
+        fprintf(stderr, "importCsrGraphFromBinaryFile: could not open file '%s'\n", path);
+        return createEmptyCsrGraph();
+    }
+    if (status == 0) {
+        fprintf(stderr, "importCsrGraphFromBinaryFile: '%s' is not a regular file\n", path);
+        unmapGraphFile(&mapped);
+        return createEmptyCsrGraph();
+    }
+
+    t_csr_graph csr = createEmptyCsrGraph();
+    if (!readBinaryHeader(mapped, path, &csr.size, &csr.edge_count)) {
+        unmapGraphFile(&mapped);
+        return createEmptyCsrGraph();
+    }
+
+    if (isLittleEndianHost() && sizeof(int) == 4) {
+        // Zero-copy: the mapping is page-aligned and every array is aligned on its element size
+        const char *data = mapped.data;
+        csr.offsets = (int *)(data + GRAPH_BINARY_HEADER_SIZE);
+        csr.targets = (int *)(data + binaryTargetsPosition((size_t)csr.size));
+        csr.weights = (double *)(data + binaryWeightsPosition((size_t)csr.size, (size_t)csr.edge_count));
+        csr.mapping = mapped;
+    } else {
+        int copied = copyBinaryArrays(mapped, &csr);
+        unmapGraphFile(&mapped);
+        if (!copied) {
+            freeCsrGraph(&csr);
+            return createEmptyCsrGraph();
+        }
+    }
+
+    if (csr.offsets[0] != 0 || csr.offsets[csr.size] != csr.edge_count) {
+        fprintf(stderr, "importCsrGraphFromBinaryFile: inconsistent offsets in '%s'\n", path);
+        freeCsrGraph(&csr);
+    }
+    return csr;
+}
+
+t_graph importGraphFromBinaryFile(const char *path) {
+    t_csr_graph csr = importCsrGraphFromBinaryFile(path);
+    if (isEmptyCsrGraph(csr)) return createEmptyGraph();
+
+    // Check every row before building anything
+    for (int v = 0; v < csr.size; v++) {
+        int valid = csr.offsets[v] <= csr.offsets[v + 1];
+        for (int e = csr.offsets[v]; valid && e < csr.offsets[v + 1]; e++) {
+            valid = csr.targets[e] >= 1 && csr.targets[e] <= csr.size;
+        }
+        if (!valid) {
+            fprintf(stderr, "importGraphFromBinaryFile: invalid edges for vertex %d in '%s'\n", v + 1, path);
+            freeCsrGraph(&csr);
+            return createEmptyGraph();
+        }
+    }
+
+    t_graph graph = createArenaGraph(csr.size);
+    if (graph.values == NULL) {
+        fprintf(stderr, "importGraphFromBinaryFile: failed to create graph\n");
+        freeCsrGraph(&csr);
+        return createEmptyGraph();
+    }
+    // addEdge inserts at the head of the list: walk each row backwards to keep its order
+    for (int v = 0; v < csr.size; v++) {
+        for (int e = csr.offsets[v + 1] - 1; e >= csr.offsets[v]; e--) {
+            addEdge(&graph, v + 1, csr.targets[e], csr.weights[e]);
+        }
+    }
+    freeCsrGraph(&csr);
+    return graph;
+}
+
+int convertGraphFileToBinary(const char *text_path, const char *binary_path) {
+    t_csr_graph csr = importCsrGraphFromFileParallel(text_path, 0);
+    if (isEmptyCsrGraph(csr)) {
+        fprintf(stderr, "convertGraphFileToBinary: could not import '%s'\n", text_path);
+        return 0;
+    }
+    int result = exportCsrGraphToBinaryFile(csr, binary_path);
+    freeCsrGraph(&csr);
+    return result;
+}
@@ -0,0 +1,73 @@
+#ifndef GRAPH_BINARY_H
+#define GRAPH_BINARY_H
+
+#include "graph.h"
+#include "csr_graph.h"
+
+/**
+ * @file graph_binary.h
+ * @brief Compact binary graph format, loadable by mapping the file in memory
+ *
+ * Every field is little-endian. The file holds, in this order:
+ * - a 32-byte header: the magic "MKVGRAPH", the format version (uint32),
+ *   a reserved uint32 (0), the number of vertices (uint64) and the number of
+ *   edges (uint64);
+ * - the CSR offsets: number of vertices + 1 int32;
+ * - the targets: one int32 per edge (1-indexed vertices);
+ * - zero padding up to the next multiple of 8 bytes;
+ * - the weights: one IEEE-754 float64 per edge.
+ *
+ * Edges are stored in the order of the adjacency lists (see t_csr_graph), so
+ * a graph saved then loaded is identical to the original one.
+ */
+
+#define GRAPH_BINARY_MAGIC "MKVGRAPH"
+#define GRAPH_BINARY_VERSION 1
+#define GRAPH_BINARY_HEADER_SIZE 32
+
+/**
+ * @brief Saves a graph in the binary format
+ * @param graph The graph to save
+ * @param path Destination file path
+ * @return 1 on success, 0 on failure
+ */
+int exportGraphToBinaryFile(t_graph graph, const char *path);
+
+/**
+ * @brief Saves a CSR graph in the binary format
+ * @param graph The CSR graph to save
+ * @param path Destination file path
+ * @return 1 on success, 0 on failure
+ */
+int exportCsrGraphToBinaryFile(t_csr_graph graph, const char *path);
+
+/**
+ * @brief Loads a graph saved in the binary format
+ * @param path Path to the binary file
+ * @return The loaded graph (arena-backed), or an empty graph on failure
+ * @note Every edge is checked: a file with out-of-range vertices or
+ *       inconsistent offsets is rejected
+ */
+t_graph importGraphFromBinaryFile(const char *path);
+
+/**
+ * @brief Loads a CSR graph saved in the binary format without copying it
+ * @param path Path to the binary file
+ * @return The loaded CSR graph, or an empty CSR graph on failure
+ * @note On a little-endian host the arrays of the result point directly into
+ *       the mapped file: loading costs O(1) plus the page faults, and
+ *       freeCsrGraph() unmaps the file. Other hosts get a byte-swapped copy.
+ * @note Only the header and the offsets bounds are checked; use
+ *       importGraphFromBinaryFile() for files that are not trusted
+ */
+t_csr_graph importCsrGraphFromBinaryFile(const char *path);
+
+/**
+ * @brief Converts a graph text file (see importGraphFromFile()) to the binary format
+ * @param text_path Path to the text file
+ * @param binary_path Destination path of the binary file
+ * @return 1 on success, 0 on failure
+ */
+int convertGraphFileToBinary(const char *text_path, const char *binary_path);
+
+#endif //GRAPH_BINARY_H
@@ -0,0 +1,240 @@
+#include "graph_loader.h"
+#include <pthread.h>
+#include "graph_reader.h"
+#include "utils.h"
+
+/* private functions =================================================== */
+
+/**
+ * @brief Part of a mapped file parsed by one thread.
+ * @param begin First byte of the chunk.
+ * @param end One past the last byte of the chunk.
+ * @param edges Edges parsed from the chunk, in file order.
+ * @param clean 1 if the chunk held only whole edges, 0 otherwise.
+ */
+typedef struct s_parse_chunk {
+    const char *begin;
+    const char *end;
+    t_edge_buffer edges;
+    int clean;
+} t_parse_chunk;
+
+/**
+ * @brief Result of the parallel parsing of a file.
+ * @param mapped Mapping of the file (kept alive while chunks are used).
+ * @param vertex_count Number of vertices read from the header.
+ * @param chunks Parsed chunks, in file order.
+ * @param chunk_count Number of chunks.
+ */
+typedef struct s_parsed_file {
+    t_mapped_file mapped;
+    int vertex_count;
+    t_parse_chunk *chunks;
+    int chunk_count;
+} t_parsed_file;
+
+/**
+ * @brief Thread entry point: parses every edge of one chunk.
+ * @param arg Pointer to the t_parse_chunk to fill.
+ * @return NULL.
+ */
+static void *parseChunk(void *arg) {
+    t_parse_chunk *chunk = (t_parse_chunk *)arg;
+    t_graph_reader reader;
+    int src, dest;
+    double weight;
+
+    openGraphReaderOnMemory(&reader, chunk->begin, (size_t)(chunk->end - chunk->begin));
+    chunk->edges = createEdgeBuffer();
+    chunk->clean = 0;
+
+    for (;;) {
+        if (!readGraphInt(&reader, &src)) {
+            // A chunk is clean only if nothing but whitespace is left
+            chunk->clean = !hasGraphToken(&reader);
+            break;
+        }
+        if (!readGraphInt(&reader, &dest) || !readGraphDouble(&reader, &weight)) break;
+        if (appendEdgeToBuffer(&chunk->edges, src, dest, weight) < 0) break;
+    }
+    closeGraphReader(&reader);
+    return NULL;
+}
+
+/**
+ * @brief Finds the start of the line following a position.
+ * @param p Position in the file.
+ * @param end End of the file.
+ * @return Pointer just after the next newline, or end.
+ */
+static const char *nextLineStart(const char *p, const char *end) {
+    while (p < end && *p != '\n') p++;
+    return (p < end) ? p + 1 : end;
+}
+
+/**
+ * @brief Releases the chunks and the mapping of a parsed file.
+ * @param parsed The parsed file.
+ */
+static void freeParsedFile(t_parsed_file *parsed) {
+    if (parsed->chunks != NULL) {
+        for (int c = 0; c < parsed->chunk_count; c++) {
+            freeEdgeBuffer(&parsed->chunks[c].edges);
+        }
+        free(parsed->chunks);
+        parsed->chunks = NULL;
+    }
+    unmapGraphFile(&parsed->mapped);
+}
+
+/**
+ * @brief Maps a file, reads its header and parses its edges on several threads.
+ * @param path Path to the file.
+ * @param thread_count Requested number of threads (0 = build default).
+ * @param parsed Receives the parsed chunks (free with freeParsedFile()).
+ * @return 1 if every chunk was parsed cleanly, 0 if the file must be parsed
+ *         sequentially instead, -1 on error (message already printed).
+ */
+static int parseFileInChunks(const char *path, int thread_count, t_parsed_file *parsed) {
+    parsed->chunks = NULL;
+    parsed->chunk_count = 0;
+
+    int status = mapGraphFile(path, GRAPH_MAP_PREFAULT, &parsed->mapped);
+    if (status < 0) {
+        fprintf(stderr, "importGraphFromFileParallel: could not open file '%s'\n", path);
+        return -1;
+    }
+    if (status == 0) return 0;
+
+    // Header: number of vertices
+    t_graph_reader reader;
+    openGraphReaderOnMemory(&reader, parsed->mapped.data, parsed->mapped.size);
+    if (!readGraphInt(&reader, &parsed->vertex_count)) {
+        fprintf(stderr, "importGraphFromFileParallel: could not read number of vertices from '%s'\n", path);
+        freeParsedFile(parsed);
+        return -1;
+    }
+    if (parsed->vertex_count < MIN_SIZE_GRAPH) {
+        fprintf(stderr, "importGraphFromFileParallel: invalid number of vertices (%d) in '%s'\n",
+                parsed->vertex_count, path);
+        freeParsedFile(parsed);
+        return -1;
+    }
+    const char *body = reader.cursor;
+    const char *end = reader.end;
+    closeGraphReader(&reader);
+
+    // One chunk per thread, but never smaller than PARALLEL_PARSE_MIN_CHUNK_SIZE
+    size_t body_size = (size_t)(end - body);
+    int chunk_count = resolveThreadCount(thread_count);
+    if ((size_t)chunk_count > body_size / PARALLEL_PARSE_MIN_CHUNK_SIZE) {
+        chunk_count = (int)(body_size / PARALLEL_PARSE_MIN_CHUNK_SIZE);
+    }
+    if (chunk_count < 1) chunk_count = 1;
+
+    parsed->chunks = calloc((size_t)chunk_count, sizeof *parsed->chunks);
+    pthread_t *threads = malloc((size_t)chunk_count * sizeof *threads);
+    int *started = calloc((size_t)chunk_count, sizeof *started);
+    if (parsed->chunks == NULL || threads == NULL || started == NULL) {
+        perror("importGraphFromFileParallel: allocation failed");
+        free(threads);
+        free(started);
+        freeParsedFile(parsed);
+        return -1;
+    }
+    parsed->chunk_count = chunk_count;
+
+    // Split on line boundaries
+    const char *chunk_begin = body;
+    for (int c = 0; c < chunk_count; c++) {
+        const char *chunk_end = end;
+        if (c < chunk_count - 1) {
+            chunk_end = nextLineStart(body + body_size * (size_t)(c + 1) / (size_t)chunk_count, end);
+            if (chunk_end < chunk_begin) chunk_end = chunk_begin;
+        }
+        parsed->chunks[c].begin = chunk_begin;
+        parsed->chunks[c].end = chunk_end;
+        chunk_begin = chunk_end;
+    }
+
+    // The calling thread parses the first chunk itself
+    for (int c = 1; c < chunk_count; c++) {
+        started[c] = (pthread_create(&threads[c], NULL, parseChunk, &parsed->chunks[c]) == 0);
+    }
+    parseChunk(&parsed->chunks[0]);
+    for (int c = 1; c < chunk_count; c++) {
+        if (started[c]) {
+            pthread_join(threads[c], NULL);
+        } else {
+            parseChunk(&parsed->chunks[c]);
+        }
+    }
+    free(threads);
+    free(started);
+
+    for (int c = 0; c < chunk_count; c++) {
+        if (!parsed->chunks[c].clean) return 0;
+    }
+    return 1;
+}
+
+/* public functions =================================================== */
+
+t_graph importGraphFromFileParallel(const char *path, int thread_count) {
+    t_parsed_file parsed;
+    int status = parseFileInChunks(path, thread_count, &parsed);
+    if (status < 0) return createEmptyGraph();
+    if (status == 0) {
+        freeParsedFile(&parsed);
+        return importGraphFromMappedFile(path);
+    }
+
+    t_graph graph = createArenaGraph(parsed.vertex_count);
+    if (graph.values == NULL) {
+        fprintf(stderr, "importGraphFromFileParallel: failed to create graph\n");
+        freeParsedFile(&parsed);
+        return createEmptyGraph();
+    }
+
+    // Merge in file order so that every adjacency list matches the sequential loader
+    for (int c = 0; c < parsed.chunk_count; c++) {
+        t_edge_buffer *edges = &parsed.chunks[c].edges;
+        for (int e = 0; e < edges->count; e++) {
+            int src = edges->srcs[e], dest = edges->dests[e];
+            if (src < 1 || src > graph.size || dest < 1 || dest > graph.size) {
+                fprintf(stderr, "importGraphFromFileParallel: edge with invalid vertices (%d -> %d) ignored\n", src, dest);
+                continue;
+            }
+            addEdge(&graph, src, dest, edges->weights[e]);
+        }
+    }
+
+    freeParsedFile(&parsed);
+    return graph;
+}
+
+t_csr_graph importCsrGraphFromFileParallel(const char *path, int thread_count) {
+    t_parsed_file parsed;
+    int status = parseFileInChunks(path, thread_count, &parsed);
+    if (status < 0) return createEmptyCsrGraph();
+    if (status == 0) {
+        freeParsedFile(&parsed);
+        return importCsrGraphFromFile(path);
+    }
+
+    t_edge_buffer *buffers = malloc((size_t)parsed.chunk_count * sizeof *buffers);
+    if (buffers == NULL) {
+        perror("importCsrGraphFromFileParallel: allocation failed");
+        freeParsedFile(&parsed);
+        return createEmptyCsrGraph();
+    }
+    for (int c = 0; c < parsed.chunk_count; c++) {
+        buffers[c] = parsed.chunks[c].edges;
+    }
+    t_csr_graph csr = createCsrGraphFromEdgeBuffers(parsed.vertex_count, buffers, parsed.chunk_count,
+                                                    "importCsrGraphFromFileParallel");
+
+    free(buffers);
+    freeParsedFile(&parsed);
+    return csr;
+}
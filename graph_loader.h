@@ -0,0 +1,46 @@
+#ifndef GRAPH_LOADER_H
+#define GRAPH_LOADER_H
+
+#include "graph.h"
+#include "csr_graph.h"
+
+/**
+ * @file graph_loader.h
+ * @brief Multi-threaded loading of graph text files
+ */
+
+/**
+ * @brief Smallest part of a file given to one parsing thread.
+ * Smaller files use fewer threads.
+ */
+#define PARALLEL_PARSE_MIN_CHUNK_SIZE (64 * 1024)
+
+/**
+ * @brief Imports a graph by parsing newline-aligned chunks of the file on several threads
+ *
+ * The file is mapped in memory. Everything after the vertex-count header is
+ * split into chunks that end on a newline. Each thread parses one chunk
+ * into its own edge buffer. The buffers are then merged in file order.
+ *
+ * @param path Path to the file containing the graph data
+ * @param thread_count Number of threads, or 0 for the build default (see resolveThreadCount())
+ * @return The imported graph, or an empty graph on failure
+ * @note The result is identical to importGraphFromFile(). If a chunk does
+ *       not hold whole "src dest weight" lines (an edge split over several
+ *       lines, trailing garbage...), the file is parsed again sequentially
+ *       so that the result still matches
+ */
+t_graph importGraphFromFileParallel(const char *path, int thread_count);
+
+/**
+ * @brief Imports a CSR graph by parsing newline-aligned chunks of the file on several threads
+ *
+ * @param path Path to the file containing the graph data
+ * @param thread_count Number of threads, or 0 for the build default (see resolveThreadCount())
+ * @return The imported CSR graph, or an empty CSR graph on failure
+ * @note Same chunking and same guarantees as importGraphFromFileParallel(),
+ *       the result is identical to importCsrGraphFromFile()
+ */
+t_csr_graph importCsrGraphFromFileParallel(const char *path, int thread_count);
+
+#endif //GRAPH_LOADER_H
@@ -0,0 +1,341 @@
+#include "graph_reader.h"
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+
+/* private functions =================================================== */
+
+/**
+ * @brief Powers of ten that are exactly representable as doubles.
+ */
+static const double exact_powers_of_ten[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+#define MAX_EXACT_POWER_OF_TEN 22
+#define MAX_EXACT_MANTISSA (1ULL << 53)
+#define MAX_FAST_DIGITS 19
+
+/**
+ * @brief Whitespace test matching the "C" locale, without the isspace() lookup.
+ */
+static int isBlank(char c) {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+static int isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * @brief Moves the unread bytes to the front of the buffer and reads more of the file.
+ * @param reader The reader.
+ */
+static void refillGraphReader(t_graph_reader *reader) {
+    if (reader->eof) return;
+
+    size_t remaining = (size_t)(reader->end - reader->cursor);
+    memmove(reader->buffer, reader->cursor, remaining);
+
+    size_t read = fread(reader->buffer + remaining, 1, reader->capacity - remaining, reader->file);
+    if (read == 0) {
+        reader->eof = 1;
+    }
+    reader->cursor = reader->buffer;
+    reader->end = reader->buffer + remaining + read;
+}
+
+/**
+ * @brief Skips whitespace, then makes sure a whole token is available in the buffer.
+ * @param reader The reader.
+ * @return 1 if a token follows, 0 at the end of the input.
+ */
+static int prepareToken(t_graph_reader *reader) {
+    for (;;) {
+        while (reader->cursor < reader->end && isBlank(*reader->cursor)) {
+            reader->cursor++;
+        }
+        if (reader->cursor < reader->end || reader->eof) break;
+        refillGraphReader(reader);
+    }
+    while (!reader->eof && reader->end - reader->cursor < GRAPH_READER_MAX_TOKEN) {
+        refillGraphReader(reader);
+    }
+    return reader->cursor < reader->end;
+}
+
+/**
+ * @brief Parses a plain decimal number when the conversion can be done exactly.
+ *
+ * A mantissa of at most 2^53 scaled by a power of ten up to 10^22 involves
+ * only exact operands, so a single multiplication or division gives the
+ * correctly rounded result, identical to strtod.
+ *
+ * @param p Start of the token.
+ * @param end End of the available input.
+ * @param value Receives the number.
+ * @return Number of characters consumed, or 0 if strtod is needed.
+ */
+static size_t parseExactDecimal(const char *p, const char *end, double *value) {
+    const char *start = p;
+    int negative = 0;
+    uint64_t mantissa = 0;
+    int significant_digits = 0;
+    int exponent = 0;
+    int has_digits = 0;
+
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = (*p == '-');
+        p++;
+    }
+    while (p < end && isDigit(*p)) {
+        if (mantissa != 0 || *p != '0') {
+            if (++significant_digits > MAX_FAST_DIGITS) return 0;
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+        }
+        has_digits = 1;
+        p++;
+    }
+    if (p < end && *p == '.') {
+        p++;
+        while (p < end && isDigit(*p)) {
+            if (mantissa != 0 || *p != '0') {
+                if (++significant_digits > MAX_FAST_DIGITS) return 0;
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            }
+            exponent--;
+            has_digits = 1;
+            p++;
+        }
+    }
+    if (!has_digits) return 0;
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        int exp_negative = 0;
+        int exp_value = 0;
+        int exp_digits = 0;
+        if (p < end && (*p == '+' || *p == '-')) {
+            exp_negative = (*p == '-');
+            p++;
+        }
+        while (p < end && isDigit(*p)) {
+            if (++exp_digits > 4) return 0;
+            exp_value = exp_value * 10 + (*p - '0');
+            p++;
+        }
+        if (exp_digits == 0) return 0;
+        exponent += exp_negative ? -exp_value : exp_value;
+    }
+
+    // Anything glued to the number (hex prefix, "inf", garbage...) goes to strtod
+    if (p < end && !isBlank(*p)) return 0;
+    if (mantissa > MAX_EXACT_MANTISSA) return 0;
+
+    double result = (double)mantissa;
+    if (mantissa != 0) {
+        if (exponent < -MAX_EXACT_POWER_OF_TEN || exponent > MAX_EXACT_POWER_OF_TEN) return 0;
+        if (exponent < 0) {
+            result /= exact_powers_of_ten[-exponent];
+        } else {
+            result *= exact_powers_of_ten[exponent];
+        }
+    }
+    *value = negative ? -result : result;
+    return (size_t)(p - start);
+}
+
+/* public functions =================================================== */
+
+int openGraphReader(t_graph_reader *reader, FILE *file) {
+    reader->file = file;
+    reader->capacity = GRAPH_READER_BUFFER_SIZE;
+    reader->buffer = malloc(reader->capacity);
+    if (reader->buffer == NULL) {
+        perror("openGraphReader: allocation failed");
+        return -1;
+    }
+    reader->cursor = reader->buffer;
+    reader->end = reader->buffer;
+    reader->eof = 0;
+    return 1;
+}
+
+void openGraphReaderOnMemory(t_graph_reader *reader, const char *data, size_t size) {
+    reader->file = NULL;
+    reader->buffer = NULL;
+    reader->capacity = 0;
+    reader->cursor = data;
+    reader->end = data + size;
+    reader->eof = 1;
+}
+
+void closeGraphReader(t_graph_reader *reader) {
+    free(reader->buffer);
+    reader->buffer = NULL;
+    reader->cursor = NULL;
+    reader->end = NULL;
+}
+
+int readGraphInt(t_graph_reader *reader, int *value) {
+    if (!prepareToken(reader)) return 0;
+
+    const char *p = reader->cursor;
+    const char *end = reader->end;
+    int negative = 0;
+    long long result = 0;
+
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = (*p == '-');
+        p++;
+    }
+    if (p >= end || !isDigit(*p)) return 0;
+    while (p < end && isDigit(*p)) {
+        // Saturate instead of overflowing, like strtol
+        if (result <= (long long)INT_MAX + 1) {
+            result = result * 10 + (*p - '0');
+        }
+        p++;
+    }
+    if (negative) result = -result;
+    if (result > INT_MAX) result = INT_MAX;
+    if (result < INT_MIN) result = INT_MIN;
+
+    *value = (int)result;
+    reader->cursor = p;
+    return 1;
+}
+
+int readGraphDouble(t_graph_reader *reader, double *value) {
+    if (!prepareToken(reader)) return 0;
+
+    size_t consumed = parseExactDecimal(reader->cursor, reader->end, value);
+    if (consumed > 0) {
+        reader->cursor += consumed;
+        return 1;
+    }
+
+    // Fallback: copy the token so that strtod sees a terminated string
+    char token[GRAPH_READER_MAX_TOKEN + 1];
+    size_t length = 0;
+    while (reader->cursor + length < reader->end && length < GRAPH_READER_MAX_TOKEN &&
+           !isBlank(reader->cursor[length])) {
+        token[length] = reader->cursor[length];
+        length++;
+    }
+    token[length] = '\0';
+
+    char *token_end;
+    double result = strtod(token, &token_end);
+    if (token_end == token) return 0;
+    if ((size_t)(token_end - token) == GRAPH_READER_MAX_TOKEN) {
+        fprintf(stderr, "readGraphDouble: number longer than %d characters\n", GRAPH_READER_MAX_TOKEN);
+        return 0;
+    }
+
+    *value = result;
+    reader->cursor += token_end - token;
+    return 1;
+}
+
+int readGraphEdge(t_graph_reader *reader, int *src, int *dest, double *weight) {
+    return readGraphInt(reader, src) && readGraphInt(reader, dest) && readGraphDouble(reader, weight);
+}
+
+int hasGraphToken(t_graph_reader *reader) {
+    return prepareToken(reader);
+}
+
+t_edge_buffer createEdgeBuffer(void) {
+    t_edge_buffer buffer = { .srcs = NULL, .dests = NULL, .weights = NULL, .count = 0, .capacity = 0 };
+    return buffer;
+}
+
+int appendEdgeToBuffer(t_edge_buffer *buffer, int src, int dest, double weight) {
+    if (buffer->count >= buffer->capacity) {
+        int capacity = (buffer->capacity == 0) ? 1024 : buffer->capacity * 2;
+        int *srcs = realloc(buffer->srcs, (size_t)capacity * sizeof *srcs);
+        if (srcs != NULL) buffer->srcs = srcs;
+        int *dests = realloc(buffer->dests, (size_t)capacity * sizeof *dests);
+        if (dests != NULL) buffer->dests = dests;
+        double *weights = realloc(buffer->weights, (size_t)capacity * sizeof *weights);
+        if (weights != NULL) buffer->weights = weights;
+        if (srcs == NULL || dests == NULL || weights == NULL) {
+            perror("appendEdgeToBuffer: realloc failed");
+            return -1;
+        }
+        buffer->capacity = capacity;
+    }
+    buffer->srcs[buffer->count] = src;
+    buffer->dests[buffer->count] = dest;
+    buffer->weights[buffer->count] = weight;
+    buffer->count++;
+    return 1;
+}
+
+void freeEdgeBuffer(t_edge_buffer *buffer) {
+    free(buffer->srcs);
+    free(buffer->dests);
+    free(buffer->weights);
+    *buffer = createEdgeBuffer();
+}
+
+int mapGraphFile(const char *path, t_map_mode mode, t_mapped_file *mapped) {
+    mapped->data = NULL;
+    mapped->size = 0;
+    mapped->fd = -1;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)) {
+        // Not mappable: keep the descriptor open so that it can be read as a stream
+        mapped->fd = fd;
+        return 0;
+    }
+    if (st.st_size == 0) {
+        // mmap rejects a zero length: an empty file is an empty area
+        close(fd);
+        return 1;
+    }
+
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    // Prefault the whole file at once instead of taking one fault per page
+    if (mode == GRAPH_MAP_PREFAULT) flags |= MAP_POPULATE;
+#endif
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, flags, fd, 0);
+    if (data == MAP_FAILED) {
+        perror("mapGraphFile: mmap failed");
+        mapped->fd = fd;
+        return 0;
+    }
+    close(fd);
+#ifndef MAP_POPULATE
+    // No prefaulting: at least read ahead, the file is parsed front to back exactly once
+    if (mode == GRAPH_MAP_PREFAULT) madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+
+    mapped->data = data;
+    mapped->size = (size_t)st.st_size;
+    return 1;
+}
+
+void unmapGraphFile(t_mapped_file *mapped) {
+    if (mapped->data != NULL) {
+        munmap((void *)mapped->data, mapped->size);
+    }
+    if (mapped->fd >= 0) {
+        close(mapped->fd);
+    }
+    mapped->data = NULL;
+    mapped->size = 0;
+    mapped->fd = -1;
+}
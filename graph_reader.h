@@ -0,0 +1,180 @@
+#ifndef GRAPH_READER_H
+#define GRAPH_READER_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+/**
+ * @file graph_reader.h
+ * @brief Buffered tokenizer for graph text files (replacement for fscanf)
+ */
+
+#define GRAPH_READER_BUFFER_SIZE (1 << 16)
+
+/**
+ * @brief Longest number the reader guarantees to parse in one piece.
+ * Longer tokens are rejected as a parse error.
+ */
+#define GRAPH_READER_MAX_TOKEN 128
+
+/**
+ * @struct s_graph_reader
+ * @brief Reads integers and doubles from a file through a large buffer
+ * @param file File being read
+ * @param buffer Buffer holding the current window of the file
+ * @param capacity Size of the buffer
+ * @param cursor Next character to read in the buffer
+ * @param end One past the last valid character in the buffer
+ * @param eof 1 once the whole file has been loaded in the buffer
+ * @note A reader opened on memory has no file and no owned buffer: it parses
+ *       the given bytes in place
+ */
+typedef struct s_graph_reader {
+    FILE *file;
+    char *buffer;
+    size_t capacity;
+    const char *cursor;
+    const char *end;
+    int eof;
+} t_graph_reader;
+
+/**
+ * @brief Initializes a reader on an already opened file
+ * @param reader Reader to initialize
+ * @param file File to read (stays owned by the caller)
+ * @return 1 on success, -1 on allocation failure
+ */
+int openGraphReader(t_graph_reader *reader, FILE *file);
+
+/**
+ * @brief Initializes a reader parsing a memory area in place
+ * @param reader Reader to initialize
+ * @param data First byte to parse (no terminating NUL needed)
+ * @param size Number of bytes to parse
+ */
+void openGraphReaderOnMemory(t_graph_reader *reader, const char *data, size_t size);
+
+/**
+ * @brief Releases the buffer of a reader (does not close the file)
+ * @param reader Reader to close
+ */
+void closeGraphReader(t_graph_reader *reader);
+
+/**
+ * @brief Reads the next integer, skipping leading whitespace (like fscanf "%d")
+ * @param reader The reader
+ * @param value Receives the integer
+ * @return 1 on success, 0 if no integer could be read
+ */
+int readGraphInt(t_graph_reader *reader, int *value);
+
+/**
+ * @brief Reads the next floating point number, skipping leading whitespace (like fscanf "%lf")
+ * @param reader The reader
+ * @param value Receives the number
+ * @return 1 on success, 0 if no number could be read
+ * @note Plain decimal numbers are converted without calling strtod when the
+ *       conversion is exact; any other syntax falls back to strtod, so the
+ *       result is always identical to fscanf
+ */
+int readGraphDouble(t_graph_reader *reader, double *value);
+
+/**
+ * @brief Reads one "src dest weight" edge
+ * @param reader The reader
+ * @param src Receives the source vertex
+ * @param dest Receives the destination vertex
+ * @param weight Receives the weight
+ * @return 1 if the three values were read, 0 otherwise
+ */
+int readGraphEdge(t_graph_reader *reader, int *src, int *dest, double *weight);
+
+/**
+ * @brief Skips whitespace and tells whether another token follows
+ * @param reader The reader
+ * @return 1 if a token follows, 0 at the end of the input
+ */
+int hasGraphToken(t_graph_reader *reader);
+
+/**
+ * @struct s_edge_buffer
+ * @brief Growable list of parsed edges, in file order
+ * @param srcs Source vertex of each edge
+ * @param dests Destination vertex of each edge
+ * @param weights Weight of each edge
+ * @param count Number of edges stored
+ * @param capacity Number of edges that fit before reallocation
+ */
+typedef struct s_edge_buffer {
+    int *srcs;
+    int *dests;
+    double *weights;
+    int count;
+    int capacity;
+} t_edge_buffer;
+
+/**
+ * @brief Creates an empty edge buffer
+ * @return An edge buffer with no storage allocated yet
+ */
+t_edge_buffer createEdgeBuffer(void);
+
+/**
+ * @brief Appends an edge at the end of a buffer, growing it if needed
+ * @param buffer The buffer
+ * @param src Source vertex
+ * @param dest Destination vertex
+ * @param weight Weight of the edge
+ * @return 1 on success, -1 on allocation failure
+ */
+int appendEdgeToBuffer(t_edge_buffer *buffer, int src, int dest, double weight);
+
+/**
+ * @brief Frees the storage of an edge buffer and resets it
+ * @param buffer The buffer to free
+ */
+void freeEdgeBuffer(t_edge_buffer *buffer);
+
+/**
+ * @struct s_mapped_file
+ * @brief Read-only memory mapping of a whole file
+ * @param data First byte of the file (NULL for an empty file)
+ * @param size Size of the file in bytes
+ * @param fd Descriptor left open when the file cannot be mapped, so that it can
+ *        still be read as a stream (fdopen()), -1 otherwise
+ */
+typedef struct s_mapped_file {
+    const char *data;
+    size_t size;
+    int fd;
+} t_mapped_file;
+
+/**
+ * @enum e_map_mode
+ * @brief How mapGraphFile() brings the pages of a file in memory.
+ */
+typedef enum e_map_mode {
+    GRAPH_MAP_LAZY,     /**< One page fault on first access, O(1) mapping (zero-copy binary loading) */
+    GRAPH_MAP_PREFAULT  /**< Whole file read at once (MAP_POPULATE), for the text parsers that read it all */
+} t_map_mode;
+
+/**
+ * @brief Maps a regular file read-only in memory
+ * @param path Path to the file
+ * @param mode GRAPH_MAP_PREFAULT to read the whole file up front, GRAPH_MAP_LAZY otherwise
+ * @param mapped Receives the mapping
+ * @return 1 on success, 0 if the file exists but cannot be mapped (pipe, FIFO,
+ *         device...), -1 if it cannot be opened
+ * @note On 0, mapped->fd is the open descriptor: a pipe cannot be opened twice
+ *       without losing its data. unmapGraphFile() closes it unless the caller
+ *       took it (and set mapped->fd to -1).
+ */
+int mapGraphFile(const char *path, t_map_mode mode, t_mapped_file *mapped);
+
+/**
+ * @brief Releases a mapping created by mapGraphFile(), or closes its descriptor
+ * @param mapped The mapping to release
+ */
+void unmapGraphFile(t_mapped_file *mapped);
+
+#endif //GRAPH_READER_H
@@ -1,4 +1,5 @@
 #include <malloc.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -129,42 +130,82 @@ void displayHasseDiagram(t_hasse_diagram hasse) {
     }
 }
 
+/**
+ * @brief Checks that a class id can index the arrays of a Hasse diagram.
+ *
+ * @param hasse The Hasse diagram.
+ * @param class_id Class ID.
+ * @return 1 if 1 <= class_id <= class_number, 0 otherwise.
+ */
+static int isValidClassId(t_hasse_diagram hasse, int class_id) {
+    return hasse.partition != NULL && class_id >= 1 && class_id <= hasse.partition->class_number;
+}
+
 t_class_type_array createClassTypeArray(t_hasse_diagram hasse) {
-    // Allocate array for all classes
-    t_class_type_array type_array = calloc(hasse.logical_size, sizeof(int));
+    // Allocate array for all classes (ids start at 1), not for all links
+    int class_count = (hasse.partition != NULL) ? hasse.partition->class_number : 0;
+    t_class_type_array type_array = calloc(class_count + 1, sizeof(int));
     if (!type_array) {
         perror("createClassTypeArray: allocation failed");
         exit(EXIT_FAILURE);
     }
 
-    // Initialize all classes as persistent (0)
-    for (int i = 0; i < hasse.logical_size; i++) {
-        type_array[i] = 0;
-
-        // Check if this class has outgoing links to other classes
-        for (int j = 0; j < hasse.logical_size; j++) {
-            if (hasse.links[j].src_id == i &&
-                hasse.links[j].dest_id != i) {
-                // Found an outgoing link to a different class
-                type_array[i] = 1; // Mark as transient
-                break;
-            }
+    // All classes are persistent (0) unless they have an outgoing link to another class
+    for (int j = 0; j < hasse.logical_size; j++) {
+        int src = hasse.links[j].src_id;
+        if (src >= 0 && src <= class_count && hasse.links[j].dest_id != src) {
+            type_array[src] = 1; // Mark as transient
         }
     }
 
     return type_array;
 }
 
+int computeClassDegrees(t_hasse_diagram *hasse) {
+    if (hasse == NULL || hasse->partition == NULL) {
+        fprintf(stderr, "computeClassDegrees: Hasse diagram or partition is NULL\n");
+        return -1;
+    }
+    int class_count = hasse->partition->class_number;
+    int *out_degrees = calloc((size_t)class_count + 1, sizeof(int));
+    int *class_sizes = calloc((size_t)class_count + 1, sizeof(int));
+    if (out_degrees == NULL || class_sizes == NULL) {
+        perror("computeClassDegrees: allocation failed");
+        free(out_degrees);
+        free(class_sizes);
+        return -1;
+    }
+    for (int j = 0; j < hasse->logical_size; j++) {
+        int src = hasse->links[j].src_id;
+        if (src >= 1 && src <= class_count && hasse->links[j].dest_id != src) out_degrees[src]++;
+    }
+    for (t_class *c = hasse->partition->classes; c != NULL; c = c->next) {
+        if (c->id >= 1 && c->id <= class_count) class_sizes[c->id] = c->vertex_number;
+    }
+    free(hasse->out_degrees);
+    free(hasse->class_sizes);
+    hasse->out_degrees = out_degrees;
+    hasse->class_sizes = class_sizes;
+    return 1;
+}
+
 void freeClassTypeArray(t_class_type_array type_array) {
     free(type_array);
 }
 
 int isPersistantClass(t_hasse_diagram hasse, int class_id) {
-    // Create type array to determine class type
-    t_class_type_array type_array = createClassTypeArray(hasse);
-    int persistante = (type_array[class_id] == 0);
-    free(type_array);
-    return persistante;
+    // Degrés précalculés : réponse immédiate
+    if (hasse.out_degrees != NULL && isValidClassId(hasse, class_id)) {
+        return hasse.out_degrees[class_id] == 0;
+    }
+
+    // Sinon, une classe est transitoire si un lien en sort vers une autre classe
+    for (int j = 0; j < hasse.logical_size; j++) {
+        if (hasse.links[j].src_id == class_id && hasse.links[j].dest_id != class_id) {
+            return 0;
+        }
+    }
+    return 1;
 }
 
 int isAbsorbingState(t_hasse_diagram hasse, int state_id, int graph_size) {
@@ -175,6 +216,10 @@ int isAbsorbingState(t_hasse_diagram hasse, int state_id, int graph_size) {
     if (!isPersistantClass(hasse, class_id))
         return 0;
 
+    // Single state in a persistent class = absorbing state
+    if (hasse.class_sizes != NULL && isValidClassId(hasse, class_id))
+        return hasse.class_sizes[class_id] == 1;
+
     // Count how many states belong to this class
     int count = 0;
     for (int i = 0; i < graph_size; i++) {
@@ -184,19 +229,69 @@ int isAbsorbingState(t_hasse_diagram hasse, int state_id, int graph_size) {
                 return 0; // More than one state means not absorbing
         }
     }
-
-    // Single state in a persistent class = absorbing state
     return 1;
 }
 
+int findAbsorbingStates(t_hasse_diagram hasse, int graph_size, int *states) {
+    if (hasse.association_array == NULL || states == NULL || graph_size < 0) {
+        fprintf(stderr, "findAbsorbingStates: invalid parameters\n");
+        return -1;
+    }
+    // Sans degrés précalculés, on les calcule sur une copie
+    t_hasse_diagram local = hasse;
+    if (hasse.out_degrees == NULL || hasse.class_sizes == NULL) {
+        local.out_degrees = NULL;
+        local.class_sizes = NULL;
+        if (computeClassDegrees(&local) < 0) return -1;
+    }
+
+    int count = 0;
+    for (int s = 0; s < graph_size; s++) {
+        int class_id = local.association_array[s];
+        if (isValidClassId(local, class_id) &&
+            local.out_degrees[class_id] == 0 && local.class_sizes[class_id] == 1) {
+            states[count++] = s + 1;
+        }
+    }
+
+    if (local.out_degrees != hasse.out_degrees) {
+        free(local.out_degrees);
+        free(local.class_sizes);
+    }
+    return count;
+}
+
+void freeHasseDiagram(t_hasse_diagram *hasse) {
+    if (hasse == NULL) return;
+    free(hasse->links);
+    free(hasse->association_array);
+    freePartition(hasse->partition);
+    free(hasse->out_degrees);
+    free(hasse->class_sizes);
+    hasse->links = NULL;
+    hasse->association_array = NULL;
+    hasse->partition = NULL;
+    hasse->out_degrees = NULL;
+    hasse->class_sizes = NULL;
+    hasse->logical_size = 0;
+    hasse->physical_size = 0;
+}
+
 int isIrreductible(t_hasse_diagram hasse) {
     // A graph is irreducible if it has only one strongly connected component
     return hasse.partition->class_number == 1;
 }
 
-t_association_array createAssociationArray(t_graph graph, t_partition partition) {
+/**
+ * @brief Creates an association array for a graph with a given number of vertices.
+ *
+ * @param size Number of vertices of the graph.
+ * @param partition The partition containing classes.
+ * @return Array where array[vertex_index] = class_id.
+ */
+static t_association_array createAssociationArrayOfSize(int size, t_partition partition) {
     // Allocate array mapping each vertex to its class ID
-    t_association_array array = calloc(graph.size, sizeof(int));
+    t_association_array array = calloc(size, sizeof(int));
 
     // Traverse all classes and their vertices
     t_class *curr_class = partition.classes;
@@ -214,82 +309,572 @@ t_association_array createAssociationArray(t_graph graph, t_partition partition)
     return array;
 }
 
-t_hasse_diagram createHasseDiagram(t_graph g){
-    printf("=== Hasse Diagram Creation ===\n");
+t_association_array createAssociationArray(t_graph graph, t_partition partition) {
+    return createAssociationArrayOfSize(graph.size, partition);
+}
 
-    printf("Partitioning graph into strongly connected components...\n");
-    // Step 1: Compute strongly connected components
-    t_partition* partition = tarjan(g);
+/**
+ * @brief Starts a condensation DAG: offsets array and class lookup by id.
+ *
+ * @param partition The partition, with class ids 1..class_number.
+ * @param dag DAG to initialize (offsets allocated, targets with room for class_number links).
+ * @return Array of class_number + 1 class pointers indexed by id, NULL on error.
+ */
+static t_class **beginCondensationDag(t_partition partition, t_condensation_dag *dag) {
+    int count = partition.class_number;
+    dag->class_count = count;
+    dag->edge_count = 0;
+    dag->offsets = calloc((size_t)count + 2, sizeof(int));
+    dag->targets = malloc((size_t)maxInt(count, 1) * sizeof(int));
+    t_class **classes = calloc((size_t)count + 1, sizeof(t_class *));
+    if (dag->offsets == NULL || dag->targets == NULL || classes == NULL) {
+        perror("createCondensationDag: allocation failed");
+        free(classes);
+        freeCondensationDag(dag);
+        return NULL;
+    }
+    for (t_class *c = partition.classes; c != NULL; c = c->next) {
+        if (c->id < 1 || c->id > count || classes[c->id] != NULL) {
+            fprintf(stderr, "createCondensationDag: class ids must be 1..%d\n", count);
+            free(classes);
+            freeCondensationDag(dag);
+            return NULL;
+        }
+        classes[c->id] = c;
+    }
+    return classes;
+}
 
-    // Step 2: Create vertex-to-class mapping
-    t_association_array association_array = createAssociationArray(g, *partition);
+/**
+ * @brief Appends the link src -> dest unless dest was already linked from src.
+ *
+ * @param dag DAG being built, row src being the last one.
+ * @param last_source last_source[d] = last class that linked to d.
+ * @param capacity Capacity of dag->targets, doubled when full.
+ * @param src Source class id.
+ * @param dest Destination class id.
+ * @return 1 on success, -1 on allocation failure.
+ */
+static int addCondensationSuccessor(t_condensation_dag *dag, int *last_source, int *capacity, int src, int dest) {
+    if (dest == src || last_source[dest] == src) return 1;
+    last_source[dest] = src;
+    if (dag->edge_count == *capacity) {
+        int *targets = realloc(dag->targets, (size_t)*capacity * 2 * sizeof(int));
+        if (targets == NULL) {
+            perror("createCondensationDag: realloc failed");
+            return -1;
+        }
+        dag->targets = targets;
+        *capacity *= 2;
+    }
+    dag->targets[dag->edge_count++] = dest;
+    return 1;
+}
+
+t_condensation_dag createCondensationDag(t_graph g, t_partition partition, t_association_array association_array) {
+    t_condensation_dag dag = {0, 0, NULL, NULL};
+    if (association_array == NULL) {
+        fprintf(stderr, "createCondensationDag: association array is NULL\n");
+        return dag;
+    }
+    t_class **classes = beginCondensationDag(partition, &dag);
+    int *last_source = calloc((size_t)partition.class_number + 1, sizeof(int));
+    if (classes == NULL || last_source == NULL) {
+        free(classes);
+        free(last_source);
+        freeCondensationDag(&dag);
+        return dag;
+    }
+    int capacity = maxInt(dag.class_count, 1);
+    int ok = 1;
+    // Une ligne par classe : arêtes sortantes de tous ses sommets
+    for (int c = 1; c <= dag.class_count && ok; c++) {
+        for (t_vertex *v = classes[c]->vertices; v != NULL && ok; v = v->next) {
+            for (t_cell *cur = g.values[v->value - 1].head; cur != NULL && ok; cur = cur->next) {
+                ok = addCondensationSuccessor(&dag, last_source, &capacity, c,
+                                              association_array[cur->vertex - 1]) == 1;
+            }
+        }
+        dag.offsets[c + 1] = dag.edge_count;
+    }
+    free(classes);
+    free(last_source);
+    if (!ok) freeCondensationDag(&dag);
+    return dag;
+}
+
+t_condensation_dag createCondensationDagFromCsr(t_csr_graph g, t_partition partition, t_association_array association_array) {
+    t_condensation_dag dag = {0, 0, NULL, NULL};
+    if (association_array == NULL) {
+        fprintf(stderr, "createCondensationDagFromCsr: association array is NULL\n");
+        return dag;
+    }
+    t_class **classes = beginCondensationDag(partition, &dag);
+    int *last_source = calloc((size_t)partition.class_number + 1, sizeof(int));
+    if (classes == NULL || last_source == NULL) {
+        free(classes);
+        free(last_source);
+        freeCondensationDag(&dag);
+        return dag;
+    }
+    int capacity = maxInt(dag.class_count, 1);
+    int ok = 1;
+    for (int c = 1; c <= dag.class_count && ok; c++) {
+        for (t_vertex *v = classes[c]->vertices; v != NULL && ok; v = v->next) {
+            int i = v->value - 1;
+            for (int e = g.offsets[i]; e < g.offsets[i + 1] && ok; e++) {
+                ok = addCondensationSuccessor(&dag, last_source, &capacity, c,
+                                              association_array[g.targets[e] - 1]) == 1;
+            }
+        }
+        dag.offsets[c + 1] = dag.edge_count;
+    }
+    free(classes);
+    free(last_source);
+    if (!ok) freeCondensationDag(&dag);
+    return dag;
+}
+
+int topologicalOrderCondensationDag(t_condensation_dag dag, int *order, int *position) {
+    if (isEmptyCondensationDag(dag) || order == NULL) {
+        fprintf(stderr, "topologicalOrderCondensationDag: invalid parameters\n");
+        return -1;
+    }
+    int *in_degree = calloc((size_t)dag.class_count + 1, sizeof(int));
+    if (in_degree == NULL) {
+        perror("topologicalOrderCondensationDag: allocation failed");
+        return -1;
+    }
+    for (int e = 0; e < dag.edge_count; e++) in_degree[dag.targets[e]]++;
+    // order sert de file : on y ajoute les classes dont tous les prédécesseurs sont placés
+    int head = 0, tail = 0;
+    for (int c = 1; c <= dag.class_count; c++)
+        if (in_degree[c] == 0) order[tail++] = c;
+    while (head < tail) {
+        int c = order[head];
+        if (position != NULL) position[c] = head;
+        head++;
+        for (int e = dag.offsets[c]; e < dag.offsets[c + 1]; e++)
+            if (--in_degree[dag.targets[e]] == 0) order[tail++] = dag.targets[e];
+    }
+    free(in_degree);
+    if (tail != dag.class_count) {
+        fprintf(stderr, "topologicalOrderCondensationDag: the class graph has a cycle\n");
+        return -1;
+    }
+    return 1;
+}
+
+static int compareInts(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Marks the links of a condensation DAG that belong to its transitive reduction.
+ *
+ * @param dag The DAG.
+ * @param order Class ids in topological order.
+ * @param position Topological position of each class id.
+ * @param start start[p] = first word of the reachability bitset of position p.
+ * @param bits Zeroed reachability bitsets of all positions.
+ * @param row Scratch array of class_count entries.
+ * @param mark Zeroed array of class_count + 1 entries.
+ * @param keep Array of edge_count flags receiving 1 for each kept link.
+ */
+static void markReducedLinks(t_condensation_dag dag, const int *order, const int *position,
+                             const size_t *start, uint64_t *bits, int *row, int *mark, unsigned char *keep) {
+    size_t words = ((size_t)dag.class_count + 63) / 64;
+    for (int p = dag.class_count - 1; p >= 0; p--) {
+        int c = order[p];
+        int first = dag.offsets[c], degree = dag.offsets[c + 1] - first;
+        uint64_t *reach = bits + start[p];
+        size_t base = (size_t)(p + 1) / 64;
+        // Successeurs du plus proche au plus lointain dans l'ordre topologique
+        for (int e = 0; e < degree; e++) row[e] = position[dag.targets[first + e]];
+        qsort(row, (size_t)degree, sizeof(int), compareInts);
+        for (int e = 0; e < degree; e++) {
+            int q = row[e];
+            uint64_t bit = (uint64_t)1 << (q % 64);
+            if (reach[q / 64 - base] & bit) continue;   // déjà atteint par un successeur plus proche
+            reach[q / 64 - base] |= bit;
+            mark[order[q]] = c;
+            // Union mot à mot avec l'ensemble atteint depuis q (positions > q, donc mots >= base)
+            const uint64_t *from = bits + start[q];
+            size_t offset = (size_t)(q + 1) / 64 - base;
+            size_t length = words - (size_t)(q + 1) / 64;
+            for (size_t w = 0; w < length; w++) reach[offset + w] |= from[w];
+        }
+        for (int e = first; e < first + degree; e++) keep[e] = (mark[dag.targets[e]] == c);
+    }
+}
+
+int reduceCondensationDag(t_condensation_dag *dag) {
+    if (dag == NULL || isEmptyCondensationDag(*dag)) {
+        fprintf(stderr, "reduceCondensationDag: empty DAG\n");
+        return -1;
+    }
+    int count = dag->class_count;
+    if (dag->edge_count == 0) return 0;
+    size_t words = ((size_t)count + 63) / 64;
+
+    // Bitset de la position p : positions p + 1 .. count - 1, à partir du mot (p + 1) / 64
+    size_t *start = malloc(((size_t)count + 1) * sizeof(size_t));
+    int *order = malloc((size_t)count * sizeof(int));
+    int *position = malloc(((size_t)count + 1) * sizeof(int));
+    int *row = malloc((size_t)count * sizeof(int));
+    int *mark = calloc((size_t)count + 1, sizeof(int));
+    unsigned char *keep = malloc((size_t)dag->edge_count);
+    uint64_t *bits = NULL;
+    if (start != NULL) {
+        start[0] = 0;
+        for (int p = 0; p < count; p++) start[p + 1] = start[p] + (words - (size_t)(p + 1) / 64);
+        bits = calloc(start[count] > 0 ? start[count] : 1, sizeof(uint64_t));
+    }
+    int removed = -1;
+    if (start == NULL || order == NULL || position == NULL || row == NULL || mark == NULL ||
+        keep == NULL || bits == NULL) {
+        fprintf(stderr, "reduceCondensationDag: allocation failed for %d classes\n", count);
+    } else if (topologicalOrderCondensationDag(*dag, order, position) == 1) {
+        markReducedLinks(*dag, order, position, start, bits, row, mark, keep);
+
+        // Compactage des lignes en gardant l'ordre des liens conservés
+        int kept = 0;
+        for (int c = 1; c <= count; c++) {
+            int first = dag->offsets[c], last = dag->offsets[c + 1];
+            dag->offsets[c] = kept;
+            for (int e = first; e < last; e++)
+                if (keep[e]) dag->targets[kept++] = dag->targets[e];
+        }
+        dag->offsets[count + 1] = kept;
+        removed = dag->edge_count - kept;
+        dag->edge_count = kept;
+    }
+    free(bits);
+    free(start);
+    free(order);
+    free(position);
+    free(row);
+    free(mark);
+    free(keep);
+    return removed;
+}
+
+int isEmptyCondensationDag(t_condensation_dag dag) {
+    return dag.offsets == NULL;
+}
+
+void freeCondensationDag(t_condensation_dag *dag) {
+    if (dag == NULL) return;
+    free(dag->offsets);
+    free(dag->targets);
+    dag->offsets = NULL;
+    dag->targets = NULL;
+    dag->class_count = 0;
+    dag->edge_count = 0;
+}
+
+/**
+ * @brief State of a BFS-level period search, shared by the row and adjacency list walks.
+ * @param level BFS level of each vertex (0-indexed), -1 if not reached yet
+ * @param queue BFS queue, also the list of the vertices reached so far
+ * @param tail Number of vertices reached so far
+ * @param class_of Class id of each vertex (0-indexed), NULL for a single class
+ * @param periods Gcd of the gaps of each class, indexed by class id
+ */
+typedef struct {
+    int *level;
+    int *queue;
+    int tail;
+    const int *class_of;
+    int *periods;
+} t_period_search;
+
+/**
+ * @brief Allocates a period search and checks the class ids.
+ *
+ * @param search Search to initialize (levels at -1, periods at 0).
+ * @param size Number of vertices.
+ * @param class_of Class id (1..class_count) of each vertex, or NULL.
+ * @param class_count Number of classes.
+ * @param periods Array of class_count + 1 entries.
+ * @param name Name of the caller, for the error messages.
+ * @return 1 on success, -1 on error.
+ */
+static int beginPeriodSearch(t_period_search *search, int size, const int *class_of, int class_count,
+                             int *periods, const char *name) {
+    for (int v = 0; class_of != NULL && v < size; v++) {
+        if (class_of[v] < 1 || class_of[v] > class_count) {
+            fprintf(stderr, "%s: class ids must be 1..%d\n", name, class_count);
+            return -1;
+        }
+    }
+    search->level = malloc((size_t)size * sizeof(int));
+    search->queue = malloc((size_t)size * sizeof(int));
+    if (search->level == NULL || search->queue == NULL) {
+        fprintf(stderr, "%s: allocation failed\n", name);
+        free(search->level);
+        free(search->queue);
+        return -1;
+    }
+    for (int v = 0; v < size; v++) search->level[v] = -1;
+    for (int c = 0; c <= class_count; c++) periods[c] = 0;
+    search->tail = 0;
+    search->class_of = class_of;
+    search->periods = periods;
+    return 1;
+}
+
+/**
+ * @brief Starts a new BFS from a vertex (0-indexed) not reached yet.
+ */
+static void pushPeriodRoot(t_period_search *search, int v) {
+    search->level[v] = 0;
+    search->queue[search->tail++] = v;
+}
+
+/**
+ * @brief Handles the edge u -> t (0-indexed) of a vertex taken from the queue.
+ *
+ * The BFS never leaves the class of u. An edge toward a vertex already
+ * reached closes cycles whose lengths differ from level(u) + 1 - level(t) by
+ * a multiple of the period, so the period is the gcd of these gaps.
+ */
+static void visitPeriodEdge(t_period_search *search, int u, int t) {
+    int id = (search->class_of != NULL) ? search->class_of[u] : 1;
+    if (search->class_of != NULL && search->class_of[t] != id) return;
+    if (search->level[t] < 0) {
+        search->level[t] = search->level[u] + 1;
+        search->queue[search->tail++] = t;
+        return;
+    }
+    int gap = search->level[u] + 1 - search->level[t];
+    search->periods[id] = gcdInt(search->periods[id], gap < 0 ? -gap : gap);
+}
+
+/**
+ * @brief Frees the arrays of a period search.
+ */
+static void endPeriodSearch(t_period_search *search) {
+    free(search->level);
+    free(search->queue);
+    search->level = NULL;
+    search->queue = NULL;
+}
+
+/**
+ * @brief Copies the period of each class id into the t_class of the partition.
+ */
+static void storeClassPeriods(t_partition *partition, const int *periods) {
+    for (t_class *c = partition->classes; c != NULL; c = c->next) {
+        if (c->id >= 1 && c->id <= partition->class_number) c->period = periods[c->id];
+    }
+}
+
+/**
+ * @brief Same as computeClassPeriods(), walking the adjacency lists of the graph (no CSR copy).
+ */
+static int computeGraphClassPeriods(t_graph g, t_partition *partition, t_association_array association_array) {
+    if (g.values == NULL || partition == NULL || association_array == NULL) {
+        fprintf(stderr, "computeClassPeriods: invalid parameters\n");
+        return -1;
+    }
+    int class_count = partition->class_number;
+    int *periods = malloc(((size_t)class_count + 1) * sizeof(int));
+    t_period_search search;
+    if (periods == NULL ||
+        beginPeriodSearch(&search, g.size, association_array, class_count, periods, "computeClassPeriods") != 1) {
+        free(periods);
+        return -1;
+    }
+    // Un BFS par classe, depuis le premier sommet de la classe non encore atteint
+    int head = 0;
+    for (int root = 0; root < g.size; root++) {
+        if (search.level[root] >= 0) continue;
+        pushPeriodRoot(&search, root);
+        while (head < search.tail) {
+            int u = search.queue[head++];
+            for (t_cell *cur = g.values[u].head; cur != NULL; cur = cur->next) {
+                visitPeriodEdge(&search, u, cur->vertex - 1);
+            }
+        }
+    }
+    endPeriodSearch(&search);
+    storeClassPeriods(partition, periods);
+    free(periods);
+    return 1;
+}
+
+int computeBfsPeriods(int size, const int *offsets, const int *targets, int target_base, const double *weights,
+                      const int *class_of, int class_count, int *periods) {
+    if (size <= 0 || offsets == NULL || targets == NULL || periods == NULL || class_count < 1) {
+        fprintf(stderr, "computeBfsPeriods: invalid parameters\n");
+        return -1;
+    }
+    t_period_search search;
+    if (beginPeriodSearch(&search, size, class_of, class_count, periods, "computeBfsPeriods") != 1) return -1;
+
+    // Un BFS par classe ; sans classes, un seul BFS depuis le sommet 0
+    int head = 0;
+    for (int root = 0; root < size; root++) {
+        if (search.level[root] >= 0) continue;
+        if (class_of == NULL && root > 0) break;
+        pushPeriodRoot(&search, root);
+        while (head < search.tail) {
+            int u = search.queue[head++];
+            for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+                if (weights != NULL && weights[e] == 0.0) continue;
+                visitPeriodEdge(&search, u, targets[e] - target_base);
+            }
+        }
+    }
+    int reached = search.tail;
+    endPeriodSearch(&search);
+    return reached;
+}
+
+int computeClassPeriods(t_csr_graph g, t_partition *partition, t_association_array association_array) {
+    if (isEmptyCsrGraph(g) || partition == NULL || association_array == NULL) {
+        fprintf(stderr, "computeClassPeriods: invalid parameters\n");
+        return -1;
+    }
+    int class_count = partition->class_number;
+    int *periods = malloc(((size_t)class_count + 1) * sizeof(int));
+    if (periods == NULL) {
+        perror("computeClassPeriods: allocation failed");
+        return -1;
+    }
+    int status = (computeBfsPeriods(g.size, g.offsets, g.targets, 1, NULL, association_array, class_count,
+                                    periods) < 0) ? -1 : 1;
+    if (status == 1) storeClassPeriods(partition, periods);
+    free(periods);
+    return status;
+}
 
-    // Step 3: Initialize Hasse diagram structure
+/**
+ * @brief Initializes a Hasse diagram whose links are the edges of a condensation DAG.
+ *
+ * @param partition The partition of the graph.
+ * @param association_array Vertex-to-class mapping of the graph.
+ * @param dag Condensation DAG of the graph (may be empty on error).
+ * @return The Hasse diagram (links = NULL and physical_size = 0 on failure).
+ */
+static t_hasse_diagram initHasseDiagram(t_partition *partition, t_association_array association_array,
+                                        t_condensation_dag dag) {
     t_hasse_diagram hasse;
     hasse.logical_size = 0;
-    hasse.physical_size = g.size;
-    hasse.links = malloc(hasse.physical_size * sizeof(t_link));
+    hasse.physical_size = 0;
+    hasse.links = NULL;
+    hasse.partition = partition;
+    hasse.association_array = association_array;
+    hasse.out_degrees = NULL;
+    hasse.class_sizes = NULL;
+    if (isEmptyCondensationDag(dag)) return hasse;
+
+    hasse.links = malloc((size_t)maxInt(dag.edge_count, 1) * sizeof(t_link));
     if (hasse.links == NULL) {
         fprintf(stderr, "createHasseDiagram: malloc failed for links array\n");
-        hasse.physical_size = 0;
-        hasse.partition = partition;
-        hasse.association_array = association_array;
         return hasse;
     }
-    hasse.partition = partition;
-    hasse.association_array = association_array;
-
-    printf("Building links between classes...\n");
-    // Step 4: Build links between different classes
-    for (int i = 0; i < g.size; i++) {
-        int ci = association_array[i];  // Class of current vertex
-        t_cell *cur = g.values[i].head;
-
-        // Examine all neighbors
-        while (cur != NULL) {
-            int v = cur->vertex - 1;
-            int cj = association_array[v];  // Class of neighbor
-
-            // Add link only if classes are different
-            if (ci != cj) {
-                addLink(&hasse, ci, cj);
-            }
-            cur = cur->next;
+    hasse.physical_size = maxInt(dag.edge_count, 1);
+    for (int c = 1; c <= dag.class_count; c++) {
+        for (int e = dag.offsets[c]; e < dag.offsets[c + 1]; e++) {
+            hasse.links[hasse.logical_size].src_id = c;
+            hasse.links[hasse.logical_size].dest_id = dag.targets[e];
+            hasse.logical_size++;
         }
     }
+    return hasse;
+}
 
-    // Step 5: Remove transitive redundancies
-    printf("Before transitive reduction: %d links\n", hasse.logical_size);
-    removeTransitiveLinks(&hasse);
+/**
+ * @brief Removes transitive redundancies from the condensation DAG and builds the Hasse diagram.
+ *
+ * Falls back to removeTransitiveLinks() if reduceCondensationDag() fails.
+ *
+ * @param partition The partition of the graph.
+ * @param association_array Vertex-to-class mapping of the graph.
+ * @param dag Pointer to the condensation DAG of the graph, freed on return.
+ * @return The Hasse diagram (links = NULL on failure).
+ */
+static t_hasse_diagram finalizeHasseDiagram(t_partition *partition, t_association_array association_array,
+                                            t_condensation_dag *dag) {
+    printf("Before transitive reduction: %d links\n", dag->edge_count);
+    int reduced = isEmptyCondensationDag(*dag) ? -1 : reduceCondensationDag(dag);
+    t_hasse_diagram hasse = initHasseDiagram(partition, association_array, *dag);
+    freeCondensationDag(dag);
+    if (hasse.links == NULL) return hasse;
+    if (reduced < 0) removeTransitiveLinks(&hasse);
+    computeClassDegrees(&hasse);
     printf("After transitive reduction: %d links\n", hasse.logical_size);
     printf("=== Hasse Diagram Complete ===\n\n");
-
     return hasse;
 }
 
+t_hasse_diagram createHasseDiagram(t_graph g){
+    printf("=== Hasse Diagram Creation ===\n");
+
+    printf("Partitioning graph into strongly connected components...\n");
+    // Step 1: Compute strongly connected components
+    t_partition* partition = tarjan(g);
+
+    // Step 2: Create vertex-to-class mapping
+    t_association_array association_array = createAssociationArray(g, *partition);
+
+    computeGraphClassPeriods(g, partition, association_array);
+
+    printf("Building links between classes...\n");
+    // Step 3: Build the condensation DAG, each link between classes once
+    t_condensation_dag dag = createCondensationDag(g, *partition, association_array);
+
+    // Step 4: Remove transitive redundancies and build the Hasse diagram from the reduced DAG
+    return finalizeHasseDiagram(partition, association_array, &dag);
+}
+
+t_hasse_diagram createHasseDiagramFromCsr(t_csr_graph g){
+    return createHasseDiagramFromCsrWithEngine(g, SCC_ENGINE_TARJAN, 0);
+}
+
+t_hasse_diagram createHasseDiagramFromCsrWithEngine(t_csr_graph g, t_scc_engine engine, int thread_count){
+    printf("=== Hasse Diagram Creation ===\n");
+
+    printf("Partitioning graph into strongly connected components (%s)...\n", getSccEngineName(engine));
+    // Step 1: Compute strongly connected components
+    t_partition* partition = computeSccPartition(g, engine, thread_count);
+
+    // Step 2: Create vertex-to-class mapping
+    t_association_array association_array = createAssociationArrayOfSize(g.size, *partition);
+    computeClassPeriods(g, partition, association_array);
+
+    printf("Building links between classes...\n");
+    // Step 3: Build the condensation DAG, each link between classes once
+    t_condensation_dag dag = createCondensationDagFromCsr(g, *partition, association_array);
+
+    // Step 4: Remove transitive redundancies and build the Hasse diagram from the reduced DAG
+    return finalizeHasseDiagram(partition, association_array, &dag);
+}
+
 void displayDetailedCharacteristics(t_hasse_diagram hasse, int graph_size) {
     printf("\n=== Displaying Graph Detailed Characteristics ===\n\n");
 
     t_partition *part = hasse.partition;
     int nb_classes = part->class_number;
 
-    // Count transient and persistent classes
+    // Count transient and persistent classes (ids 1..nb_classes)
     int transient_count = 0, persistent_count = 0;
-    for (int i = 0; i < nb_classes; i++) {
+    for (int i = 1; i <= nb_classes; i++) {
         if (isPersistantClass(hasse, i))
             persistent_count++;
         else
             transient_count++;
     }
 
-    // Detect all absorbing states
-    int absorbing_states[graph_size];
-    int absorbing_count = 0;
-
-    for (int s = 0; s < graph_size; s++) {
-        if (isAbsorbingState(hasse, s + 1, graph_size)) {
-            absorbing_states[absorbing_count++] = s + 1;
-        }
+    // Detect all absorbing states in one pass
+    int *absorbing_states = malloc((size_t)maxInt(graph_size, 1) * sizeof(int));
+    int absorbing_count = (absorbing_states != NULL) ? findAbsorbingStates(hasse, graph_size, absorbing_states) : -1;
+    if (absorbing_count < 0) {
+        fprintf(stderr, "displayDetailedCharacteristics: cannot list absorbing states\n");
+        absorbing_count = 0;
     }
 
     // Print summary statistics
@@ -307,6 +892,7 @@ void displayDetailedCharacteristics(t_hasse_diagram hasse, int graph_size) {
         printf(")");
     }
     printf("\n\n");
+    free(absorbing_states);
 
     // Display detailed information for each class
     printf("   Detailed class information:\n");
@@ -327,6 +913,10 @@ void displayDetailedCharacteristics(t_hasse_diagram hasse, int graph_size) {
 
         // Print class type
         printf("     Type : %s\n", isPersistantClass(hasse, id) ? "Persistent" : "Transient");
+        if (classe->period > 1)
+            printf("     Period : %d\n", classe->period);
+        else if (classe->period == 1)
+            printf("     Period : 1 (aperiodic)\n");
 
         // Check for absorbing states in singleton classes
         if (classe->vertices != NULL && classe->vertices->next == NULL) {
@@ -3,6 +3,8 @@
 
 #include "partition.h"
 #include "graph.h"
+#include "csr_graph.h"
+#include "scc.h"
 
 /**
  * @brief Represents a directed link between two classes in a Hasse diagram.
@@ -31,6 +33,10 @@ typedef int* t_association_array;
  * @param association_array Maps vertices to class IDs
  * @param logical_size Current number of links
  * @param physical_size Maximum capacity before needing reallocation
+ * @param out_degrees Number of links leaving each class, indexed by class ID
+ *        (NULL until computeClassDegrees() is called)
+ * @param class_sizes Number of vertices of each class, indexed by class ID
+ *        (NULL until computeClassDegrees() is called)
  */
 typedef struct s_link_array {
     t_link* links;
@@ -38,6 +44,8 @@ typedef struct s_link_array {
     t_association_array association_array;
     int logical_size;
     int physical_size;
+    int *out_degrees;
+    int *class_sizes;
 } t_link_array;
 
 /**
@@ -45,11 +53,30 @@ typedef struct s_link_array {
  */
 typedef t_link_array t_hasse_diagram;
 
+/**
+ * @brief Condensation DAG of a graph: one node per class, one edge per linked pair of classes.
+ *
+ * Adjacency array indexed by class id (1..class_count): the successors of
+ * class c are targets[offsets[c]] .. targets[offsets[c + 1] - 1], each listed once.
+ * @param class_count Number of classes
+ * @param edge_count Number of distinct links between classes
+ * @param offsets Array of class_count + 2 entries (offsets[0] = offsets[1] = 0)
+ * @param targets Array of edge_count class ids
+ */
+typedef struct s_condensation_dag {
+    int class_count;
+    int edge_count;
+    int *offsets;
+    int *targets;
+} t_condensation_dag;
+
 /**
  * @brief Removes transitive redundant links from the link array.
  *
  * Eliminates links that can be inferred through transitivity.
  * For example, if A->B and B->C exist, then A->C is redundant.
+ * Only paths of two links are checked, in O(L^3): the Hasse diagram builders
+ * use reduceCondensationDag() and keep this function as a fallback.
  *
  * @param p_link_array Pointer to the link array to clean.
  */
@@ -93,6 +120,18 @@ void displayHasseDiagram(t_hasse_diagram hasse);
  */
 t_class_type_array createClassTypeArray(t_link_array link_array);
 
+/**
+ * @brief Computes the out-degree and the size of every class once.
+ *
+ * Called by the Hasse diagram builders, so that isPersistantClass() and
+ * isAbsorbingState() answer in O(1) instead of scanning all links.
+ * Must be called again if links are added or removed afterwards.
+ *
+ * @param hasse Pointer to the Hasse diagram (its partition must have class ids 1..class_number).
+ * @return 1 on success, -1 on error.
+ */
+int computeClassDegrees(t_hasse_diagram *hasse);
+
 /**
  * @brief Frees memory allocated for a class type array.
  *
@@ -110,10 +149,116 @@ void freeClassTypeArray(t_class_type_array type_array);
  */
 t_association_array createAssociationArray(t_graph graph, t_partition partition);
 
+/**
+ * @brief Builds the condensation DAG of a graph in O(V + E).
+ *
+ * The vertices are visited class by class; a marker array remembers the last
+ * class that linked to each class, so every link is kept once without
+ * searching the links already found.
+ *
+ * @param g The graph.
+ * @param partition Its partition, with class ids 1..class_number.
+ * @param association_array Vertex-to-class mapping, see createAssociationArray().
+ * @return The DAG, empty (offsets == NULL) on error. Caller must free with freeCondensationDag().
+ */
+t_condensation_dag createCondensationDag(t_graph g, t_partition partition, t_association_array association_array);
+
+/**
+ * @brief Builds the condensation DAG of a CSR graph in O(V + E).
+ *
+ * Same as createCondensationDag(), reading the CSR arrays.
+ *
+ * @param g The CSR graph.
+ * @param partition Its partition, with class ids 1..class_number.
+ * @param association_array Vertex-to-class mapping of the graph.
+ * @return The DAG, empty (offsets == NULL) on error. Caller must free with freeCondensationDag().
+ */
+t_condensation_dag createCondensationDagFromCsr(t_csr_graph g, t_partition partition, t_association_array association_array);
+
+/**
+ * @brief BFS-level periods of the classes of a graph stored as rows, in O(V + E).
+ *
+ * Engine of computeClassPeriods() and computeStationaryPeriod(). Each class
+ * is explored by a BFS that never leaves it; an edge u -> v inside the class
+ * closes cycles whose lengths differ from level(u) + 1 - level(v) by a
+ * multiple of the period, which is the gcd of these gaps.
+ *
+ * @param size Number of vertices.
+ * @param offsets Array of size + 1 entries: the edges of vertex u (0-indexed) are [offsets[u], offsets[u + 1]).
+ * @param targets Target of each edge, numbered from target_base.
+ * @param target_base Number of the first vertex in targets (1 for a CSR graph, 0 for a sparse matrix).
+ * @param weights Weight of each edge, edges of weight 0 being ignored; NULL keeps every edge.
+ * @param class_of Class id (1..class_count) of each vertex (0-indexed); NULL for a single
+ *        class explored from vertex 0 only.
+ * @param class_count Number of classes (1 when class_of is NULL).
+ * @param periods Array of class_count + 1 entries, receives the period of class c in periods[c]
+ *        (0 for a class without cycle).
+ * @return Number of vertices reached, -1 on error.
+ */
+int computeBfsPeriods(int size, const int *offsets, const int *targets, int target_base, const double *weights,
+                      const int *class_of, int class_count, int *periods);
+
+/**
+ * @brief Computes the period of every class of a partition in O(V + E).
+ *
+ * Each class is explored by a BFS from one of its vertices without leaving
+ * it. An edge u -> v inside the class closes cycles whose lengths differ
+ * from level(u) + 1 - level(v) by a multiple of the period, so the period is
+ * the gcd of these gaps over all the edges of the class. Results are stored
+ * in the period field of each t_class (1 for an aperiodic class, 0 for a
+ * single state without loop). The Hasse diagram constructors call it.
+ *
+ * @param g The CSR graph.
+ * @param partition Its partition, with class ids 1..class_number.
+ * @param association_array Vertex-to-class mapping of the graph.
+ * @return 1 on success, -1 on error.
+ */
+int computeClassPeriods(t_csr_graph g, t_partition *partition, t_association_array association_array);
+
+/**
+ * @brief Topological order of a condensation DAG (Kahn's algorithm): every link goes forward.
+ *
+ * @param dag The DAG.
+ * @param order Array of class_count entries receiving the class ids in topological order.
+ * @param position Array of class_count + 1 entries receiving the position of each class id, or NULL.
+ * @return 1 on success, -1 on allocation failure or if the graph has a cycle.
+ */
+int topologicalOrderCondensationDag(t_condensation_dag dag, int *order, int *position);
+
+/**
+ * @brief Removes from a condensation DAG every link implied by a longer path.
+ *
+ * Classes are visited in reverse topological order. Each class keeps the set
+ * of classes it reaches as a bitset over topological positions (only the
+ * positions after its own, so about class_count^2 / 2 bits in total), merged
+ * 64 classes at a time. A successor is redundant if it is already reached
+ * through a successor closer in topological order. Unlike
+ * removeTransitiveLinks(), paths of any length are taken into account and the
+ * result, the unique transitive reduction of the DAG, does not depend on link order.
+ *
+ * @param dag Pointer to the DAG, reduced in place (the order of the kept links is unchanged).
+ * @return Number of links removed, -1 on error (allocation failure or cycle).
+ */
+int reduceCondensationDag(t_condensation_dag *dag);
+
+/**
+ * @brief Checks if a condensation DAG is empty (never built or failed).
+ * @param dag The DAG.
+ * @return 1 if empty, 0 otherwise.
+ */
+int isEmptyCondensationDag(t_condensation_dag dag);
+
+/**
+ * @brief Frees a condensation DAG and resets it to empty.
+ * @param dag Pointer to the DAG.
+ */
+void freeCondensationDag(t_condensation_dag *dag);
+
 /**
  * @brief Checks if a class is persistent.
  *
  * A class is persistent if it has no outgoing links to other classes.
+ * O(1) once computeClassDegrees() has been called, otherwise all links are scanned.
  *
  * @param hasse The Hasse diagram.
  * @param class_id ID of the class to check.
@@ -135,6 +280,23 @@ int isPersistantClass(t_hasse_diagram hasse, int class_id);
  */
 int isAbsorbingState(t_hasse_diagram hasse, int state_id, int graph_size);
 
+/**
+ * @brief Finds all absorbing states in a single pass over the vertices.
+ *
+ * @param hasse The Hasse diagram.
+ * @param graph_size Total number of vertices in the graph.
+ * @param states Array of graph_size entries receiving the absorbing states (1-indexed), in increasing order.
+ * @return Number of absorbing states, -1 on error.
+ */
+int findAbsorbingStates(t_hasse_diagram hasse, int graph_size, int *states);
+
+/**
+ * @brief Frees a Hasse diagram: links, association array, partition and class degrees.
+ *
+ * @param hasse Pointer to the Hasse diagram, reset to empty.
+ */
+void freeHasseDiagram(t_hasse_diagram *hasse);
+
 /**
  * @brief Checks if the graph is irreducible.
  *
@@ -151,14 +313,39 @@ int isIrreductible(t_hasse_diagram hasse);
  * This function:
  * 1. Computes strongly connected components using Tarjan's algorithm
  * 2. Creates an association array mapping vertices to classes
- * 3. Builds links between different classes
- * 4. Removes transitive redundancies
+ * 3. Builds links between different classes from the condensation DAG
+ * 4. Removes transitive redundancies with reduceCondensationDag()
  *
  * @param g The graph to analyze.
  * @return Complete Hasse diagram structure.
  */
 t_hasse_diagram createHasseDiagram(t_graph g);
 
+/**
+ * @brief Creates a complete Hasse diagram from a CSR graph.
+ *
+ * Same steps as createHasseDiagram(), using tarjanCsr() and
+ * createCondensationDagFromCsr() to build the links between classes.
+ *
+ * @param g The CSR graph to analyze.
+ * @return Complete Hasse diagram structure.
+ */
+t_hasse_diagram createHasseDiagramFromCsr(t_csr_graph g);
+
+/**
+ * @brief Creates a complete Hasse diagram from a CSR graph with a chosen SCC engine.
+ *
+ * Same as createHasseDiagramFromCsr(), with the strongly connected components
+ * computed by computeSccPartition(). Class ids depend on the engine, the
+ * classes and links between them do not.
+ *
+ * @param g The CSR graph to analyze.
+ * @param engine SCC_ENGINE_TARJAN or SCC_ENGINE_PARALLEL.
+ * @param thread_count Number of threads of the parallel engine (<= 0: default).
+ * @return Complete Hasse diagram structure.
+ */
+t_hasse_diagram createHasseDiagramFromCsrWithEngine(t_csr_graph g, t_scc_engine engine, int thread_count);
+
 /**
  * @brief Displays comprehensive characteristics of the graph.
  *
@@ -0,0 +1,318 @@
+#include "hitting.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils.h"
+
+/** Flags of a state (or a class) during one target set. */
+#define HITTING_TARGET 1
+#define HITTING_INFINITE 2
+#define HITTING_REACHES 4
+
+/* private functions =================================================== */
+
+/**
+ * @brief Marks as infinite the states of a class that may reach an infinite state before a target.
+ *
+ * Seeds are the non-target states with an edge to an infinite state of an
+ * other class; the mark then spreads backwards inside the class, never through a target.
+ *
+ * @param ctx Context of the graph.
+ * @param c The class.
+ * @param flags Flags of every state.
+ * @param stack Scratch array of graph.size entries.
+ */
+static void markInfiniteStates(const t_hitting_context *ctx, t_class *c, unsigned char *flags, int *stack) {
+    t_csr_graph g = ctx->graph;
+    int top = 0;
+    for (t_vertex *v = c->vertices; v != NULL; v = v->next) {
+        int i = v->value - 1;
+        if (flags[i] & HITTING_TARGET) continue;
+        for (int e = g.offsets[i]; e < g.offsets[i + 1]; e++) {
+            if (flags[g.targets[e] - 1] & HITTING_INFINITE) {
+                flags[i] |= HITTING_INFINITE;
+                stack[top++] = i;
+                break;
+            }
+        }
+    }
+    while (top > 0) {
+        int x = stack[--top];
+        for (int e = ctx->reverse.offsets[x]; e < ctx->reverse.offsets[x + 1]; e++) {
+            int u = ctx->reverse.targets[e] - 1;
+            if (ctx->association_array[u] != c->id || (flags[u] & (HITTING_TARGET | HITTING_INFINITE))) continue;
+            flags[u] |= HITTING_INFINITE;
+            stack[top++] = u;
+        }
+    }
+}
+
+/**
+ * @brief Solves the finite times of one class by Gauss-Seidel sweeps.
+ *
+ * h_i = (1 + sum over j != i of P_ij h_j) / (1 - P_ii). Every class reached
+ * from this one is already solved and no finite state has an edge to an
+ * infinite one.
+ *
+ * @return Number of sweeps (0 if nothing to solve), -1 on error or without convergence.
+ */
+static int solveHittingClass(const t_hitting_context *ctx, t_class *c, const unsigned char *flags,
+                             double tolerance, double *times) {
+    t_csr_graph g = ctx->graph;
+    for (int sweep = 1; sweep <= HITTING_MAX_ITERATIONS; sweep++) {
+        double change = 0.0;
+        int solved = 0;
+        for (t_vertex *v = c->vertices; v != NULL; v = v->next) {
+            int i = v->value - 1;
+            if (flags[i]) continue;
+            double diag = 0.0, time = 1.0;
+            for (int e = g.offsets[i]; e < g.offsets[i + 1]; e++) {
+                int j = g.targets[e] - 1;
+                if (j == i) diag += g.weights[e];
+                else time += g.weights[e] * times[j];
+            }
+            if (diag >= 1.0) {
+                fprintf(stderr, "computeHittingTimes: state %d cannot be left\n", i + 1);
+                return -1;
+            }
+            time /= 1.0 - diag;
+            change = fmax(change, fabs(time - times[i]) / fmax(1.0, time));
+            times[i] = time;
+            solved++;
+        }
+        // Un état seul ne dépend que de classes déjà résolues : un passage suffit
+        if (solved == 0) return 0;
+        if (c->vertex_number == 1 || change < tolerance) return sweep;
+    }
+    fprintf(stderr, "computeHittingTimes: class %d did not converge in %d sweeps\n", c->id, HITTING_MAX_ITERATIONS);
+    return -1;
+}
+
+/**
+ * @brief Hitting times of one target set with caller-provided scratch arrays.
+ * @param flags Zeroed array of graph.size entries.
+ * @param class_flags Zeroed array of class_number + 1 entries.
+ * @param stack Array of graph.size entries.
+ */
+static int hittingTimesWithScratch(const t_hitting_context *ctx, const int *targets, int target_count,
+                                   double tolerance, double *times, unsigned char *flags,
+                                   unsigned char *class_flags, int *stack) {
+    t_csr_graph g = ctx->graph;
+    for (int t = 0; t < target_count; t++) {
+        if (targets[t] < 1 || targets[t] > g.size) {
+            fprintf(stderr, "computeHittingTimes: target %d out of range [1..%d]\n", targets[t], g.size);
+            return -1;
+        }
+        flags[targets[t] - 1] = HITTING_TARGET;
+        class_flags[ctx->association_array[targets[t] - 1]] = HITTING_TARGET;
+    }
+    memset(times, 0, (size_t)g.size * sizeof *times);
+
+    // Classes puits d'abord : tout ce qu'une classe atteint est déjà décidé
+    t_condensation_dag dag = ctx->dag;
+    for (int p = dag.class_count - 1; p >= 0; p--) {
+        int id = ctx->order[p];
+        t_class *c = ctx->classes[id];
+        // reach : la classe contient une cible ou mène à une classe qui en atteint une
+        int reach = class_flags[id] & HITTING_TARGET;
+        for (int e = dag.offsets[id]; e < dag.offsets[id + 1] && !reach; e++) {
+            reach = class_flags[dag.targets[e]] & HITTING_REACHES;
+        }
+        if (reach) class_flags[id] |= HITTING_REACHES;
+
+        if (!reach) {
+            for (t_vertex *v = c->vertices; v != NULL; v = v->next) flags[v->value - 1] |= HITTING_INFINITE;
+        } else {
+            markInfiniteStates(ctx, c, flags, stack);
+        }
+        if (solveHittingClass(ctx, c, flags, tolerance, times) < 0) return -1;
+    }
+    for (int i = 0; i < g.size; i++) {
+        if (flags[i] & HITTING_INFINITE) times[i] = INFINITY;
+    }
+    return 1;
+}
+
+/**
+ * @brief Shared state of the workers of computeHittingTimesBatch().
+ * @param next Next target set to hand out, protected by lock.
+ */
+typedef struct s_hitting_jobs {
+    const t_hitting_context *ctx;
+    const int *const *target_sets;
+    const int *target_counts;
+    int count;
+    double tolerance;
+    double **times;
+    int *status;
+    int next;
+    pthread_mutex_t lock;
+} t_hitting_jobs;
+
+/**
+ * @brief Worker: takes the next target set until none is left.
+ */
+static void *solveHittingJobs(void *arg) {
+    t_hitting_jobs *jobs = (t_hitting_jobs *)arg;
+    for (;;) {
+        pthread_mutex_lock(&jobs->lock);
+        int index = jobs->next++;
+        pthread_mutex_unlock(&jobs->lock);
+        if (index >= jobs->count) break;
+        jobs->status[index] = computeHittingTimes(jobs->ctx, jobs->target_sets[index], jobs->target_counts[index],
+                                                  jobs->tolerance, jobs->times[index]);
+    }
+    return NULL;
+}
+
+/* public functions =================================================== */
+
+int createHittingContext(t_csr_graph graph, t_partition *partition, t_hitting_context *ctx) {
+    if (ctx == NULL || isEmptyCsrGraph(graph) || partition == NULL) {
+        fprintf(stderr, "createHittingContext: invalid parameters\n");
+        return -1;
+    }
+    int class_count = partition->class_number;
+    memset(ctx, 0, sizeof *ctx);
+    ctx->graph = graph;
+    ctx->partition = partition;
+    ctx->association_array = calloc((size_t)graph.size, sizeof(int));
+    ctx->order = malloc((size_t)(class_count > 0 ? class_count : 1) * sizeof(int));
+    ctx->classes = calloc((size_t)class_count + 1, sizeof(t_class *));
+    if (ctx->association_array == NULL || ctx->order == NULL || ctx->classes == NULL) {
+        perror("createHittingContext: allocation failed");
+        freeHittingContext(ctx);
+        return -1;
+    }
+    for (t_class *c = partition->classes; c != NULL; c = c->next) {
+        if (c->id < 1 || c->id > class_count) {
+            fprintf(stderr, "createHittingContext: class ids must be 1..%d\n", class_count);
+            freeHittingContext(ctx);
+            return -1;
+        }
+        ctx->classes[c->id] = c;
+        for (t_vertex *v = c->vertices; v != NULL; v = v->next) ctx->association_array[v->value - 1] = c->id;
+    }
+    for (int i = 0; i < graph.size; i++) {
+        if (ctx->association_array[i] == 0) {
+            fprintf(stderr, "createHittingContext: state %d has no class\n", i + 1);
+            freeHittingContext(ctx);
+            return -1;
+        }
+    }
+    ctx->reverse = transposeCsrGraph(graph);
+    ctx->dag = createCondensationDagFromCsr(graph, *partition, ctx->association_array);
+    if (isEmptyCsrGraph(ctx->reverse) || isEmptyCondensationDag(ctx->dag) ||
+        topologicalOrderCondensationDag(ctx->dag, ctx->order, NULL) < 0) {
+        freeHittingContext(ctx);
+        return -1;
+    }
+    return 1;
+}
+
+void freeHittingContext(t_hitting_context *ctx) {
+    if (ctx == NULL) return;
+    free(ctx->association_array);
+    free(ctx->order);
+    free(ctx->classes);
+    if (!isEmptyCsrGraph(ctx->reverse)) freeCsrGraph(&ctx->reverse);
+    freeCondensationDag(&ctx->dag);
+    memset(ctx, 0, sizeof *ctx);
+}
+
+int computeHittingTimes(const t_hitting_context *ctx, const int *targets, int target_count,
+                        double tolerance, double *times) {
+    if (ctx == NULL || ctx->order == NULL || targets == NULL || target_count <= 0 ||
+        times == NULL || !(tolerance > 0.0)) {
+        fprintf(stderr, "computeHittingTimes: invalid parameters\n");
+        return -1;
+    }
+    int size = ctx->graph.size;
+    unsigned char *flags = calloc((size_t)size, 1);
+    unsigned char *class_flags = calloc((size_t)ctx->dag.class_count + 1, 1);
+    int *stack = malloc((size_t)size * sizeof(int));
+    int result = -1;
+    if (flags == NULL || class_flags == NULL || stack == NULL) {
+        perror("computeHittingTimes: allocation failed");
+    } else {
+        result = hittingTimesWithScratch(ctx, targets, target_count, tolerance, times, flags, class_flags, stack);
+    }
+    free(flags);
+    free(class_flags);
+    free(stack);
+    return result;
+}
+
+int computeHittingTimesBatch(const t_hitting_context *ctx, const int *const *target_sets,
+                             const int *target_counts, int set_count, double tolerance,
+                             int thread_count, double **times) {
+    if (ctx == NULL || target_sets == NULL || target_counts == NULL || times == NULL || set_count < 0) {
+        fprintf(stderr, "computeHittingTimesBatch: invalid parameters\n");
+        return -1;
+    }
+    if (set_count == 0) return 1;
+    t_hitting_jobs jobs = { .ctx = ctx, .target_sets = target_sets, .target_counts = target_counts,
+                            .count = set_count, .tolerance = tolerance, .times = times, .next = 0 };
+    int workers = minInt(resolveThreadCount(thread_count), set_count);
+    jobs.status = malloc((size_t)set_count * sizeof *jobs.status);
+    pthread_t *threads = malloc((size_t)workers * sizeof *threads);
+    int *started = calloc((size_t)workers, sizeof *started);
+    if (jobs.status == NULL || threads == NULL || started == NULL) {
+        perror("computeHittingTimesBatch: allocation failed");
+        free(jobs.status);
+        free(threads);
+        free(started);
+        return -1;
+    }
+
+    // Le thread appelant travaille aussi
+    pthread_mutex_init(&jobs.lock, NULL);
+    for (int t = 1; t < workers; t++) {
+        started[t] = (pthread_create(&threads[t], NULL, solveHittingJobs, &jobs) == 0);
+    }
+    solveHittingJobs(&jobs);
+    for (int t = 1; t < workers; t++) {
+        if (started[t]) pthread_join(threads[t], NULL);
+    }
+    pthread_mutex_destroy(&jobs.lock);
+
+    int result = 1;
+    for (int i = 0; i < set_count; i++) {
+        if (jobs.status[i] != 1) {
+            fprintf(stderr, "computeHittingTimesBatch: target set %d failed\n", i);
+            result = -1;
+        }
+    }
+    free(jobs.status);
+    free(threads);
+    free(started);
+    return result;
+}
+
+double meanFirstPassageTime(const t_hitting_context *ctx, int from, int to) {
+    if (ctx == NULL || from < 1 || from > ctx->graph.size) {
+        fprintf(stderr, "meanFirstPassageTime: invalid start state\n");
+        return -1.0;
+    }
+    double *times = malloc((size_t)ctx->graph.size * sizeof *times);
+    if (times == NULL) {
+        perror("meanFirstPassageTime: allocation failed");
+        return -1.0;
+    }
+    double result = -1.0;
+    if (computeHittingTimes(ctx, &to, 1, HITTING_DEFAULT_TOLERANCE, times) == 1) {
+        if (from != to) {
+            result = times[from - 1];
+        } else {
+            // Temps de retour : un pas, puis le temps d'atteinte depuis le voisin
+            t_csr_graph g = ctx->graph;
+            result = 1.0;
+            for (int e = g.offsets[from - 1]; e < g.offsets[from]; e++) {
+                if (g.weights[e] > 0.0) result += g.weights[e] * times[g.targets[e] - 1];
+            }
+        }
+    }
+    free(times);
+    return result;
+}
@@ -0,0 +1,107 @@
+#ifndef HITTING_H
+#define HITTING_H
+
+#include "csr_graph.h"
+#include "partition.h"
+#include "hasse.h"
+
+/**
+ * @file hitting.h
+ * @brief Mean first-passage (hitting) times to a set of target states.
+ *
+ * h(i) = 0 on a target and h(i) = 1 + sum over j of P_ij h(j) elsewhere. The
+ * class structure answers most of the question before any arithmetic: a class
+ * that cannot reach a target, or that can leave towards a state that may miss
+ * the targets forever, has infinite times. The remaining states are solved
+ * one class at a time in reverse topological order of the condensation DAG,
+ * by Gauss-Seidel sweeps over their own CSR rows. Everything that does not
+ * depend on the targets (reverse graph, condensation DAG, topological order)
+ * is built once in a t_hitting_context and shared by every target set.
+ */
+
+/** Default threshold on the relative change of a Gauss-Seidel sweep. */
+#define HITTING_DEFAULT_TOLERANCE 1e-12
+
+/** Sweep cap of the Gauss-Seidel solve of one class. */
+#define HITTING_MAX_ITERATIONS 100000
+
+/**
+ * @brief Target-independent data shared by all hitting-time computations on a graph.
+ * @param graph The CSR graph (borrowed, must outlive the context)
+ * @param partition Its partition in strongly connected components (borrowed)
+ * @param association_array Class ID of each vertex (index vertex - 1)
+ * @param reverse Reverse graph, to find the predecessors of a state
+ * @param dag Condensation DAG of the graph
+ * @param order Class IDs in topological order
+ * @param classes Class of each ID (class_number + 1 entries)
+ */
+typedef struct s_hitting_context {
+    t_csr_graph graph;
+    t_partition *partition;
+    t_association_array association_array;
+    t_csr_graph reverse;
+    t_condensation_dag dag;
+    int *order;
+    t_class **classes;
+} t_hitting_context;
+
+/**
+ * @brief Builds the shared data of hitting-time computations, in O(V + E).
+ * @param graph The CSR graph (rows summing to 1).
+ * @param partition Its partition, e.g. from tarjanCsr(), with class ids 1..class_number.
+ * @param ctx Receives the context, to free with freeHittingContext().
+ * @return 1 on success, -1 on error.
+ */
+int createHittingContext(t_csr_graph graph, t_partition *partition, t_hitting_context *ctx);
+
+/**
+ * @brief Frees a hitting context (not the graph nor the partition).
+ * @param ctx Pointer to the context.
+ */
+void freeHittingContext(t_hitting_context *ctx);
+
+/**
+ * @brief Mean first-passage time of every state to a set of targets.
+ * @param ctx Context of the graph.
+ * @param targets Target states (1-indexed), duplicates allowed.
+ * @param target_count Number of targets (> 0).
+ * @param tolerance Threshold on the relative change of a sweep (> 0), e.g. HITTING_DEFAULT_TOLERANCE.
+ * @param times Array of graph.size entries receiving the time of each state (index state - 1):
+ *        0 on a target, INFINITY when the targets may never be reached.
+ * @return 1 on success, -1 on error or if a class reaches HITTING_MAX_ITERATIONS.
+ */
+int computeHittingTimes(const t_hitting_context *ctx, const int *targets, int target_count,
+                        double tolerance, double *times);
+
+/**
+ * @brief Mean first-passage times to several target sets, on several threads.
+ *
+ * The context is shared; each thread only allocates the per-set scratch
+ * arrays. The results do not depend on the number of threads.
+ *
+ * @param ctx Context of the graph.
+ * @param target_sets Array of set_count arrays of target states.
+ * @param target_counts Number of targets of each set.
+ * @param set_count Number of target sets.
+ * @param tolerance Threshold on the relative change of a sweep (> 0).
+ * @param thread_count Number of threads (<= 0: MARKOV_DEFAULT_THREADS, see resolveThreadCount()).
+ * @param times Array of set_count arrays of graph.size entries, filled like computeHittingTimes().
+ * @return 1 if every set succeeded, -1 otherwise.
+ */
+int computeHittingTimesBatch(const t_hitting_context *ctx, const int *const *target_sets,
+                             const int *target_counts, int set_count, double tolerance,
+                             int thread_count, double **times);
+
+/**
+ * @brief Mean first-passage time from one state to another.
+ *
+ * When from == to, this is the mean return time 1 + sum over k of P_from,k h(k).
+ *
+ * @param ctx Context of the graph.
+ * @param from Start state (1-indexed).
+ * @param to Target state (1-indexed).
+ * @return The mean time (INFINITY if to may never be reached), -1 on error.
+ */
+double meanFirstPassageTime(const t_hitting_context *ctx, int from, int to);
+
+#endif //HITTING_H
@@ -26,6 +26,24 @@ int addCell(t_list *list, int vertex, double weight)
     return 1;
 }
 
+int addArenaCell(t_list *list, t_cell_arena *arena, int vertex, double weight)
+{
+    if (list == NULL) {
+        fprintf(stderr, "addArenaCell: list pointer is NULL\n");
+        return -1;
+    }
+
+    t_cell *cell = createArenaCell(arena, vertex, weight);
+    if (cell == NULL) {
+        fprintf(stderr, "addArenaCell: failed to create cell\n");
+        return -1;
+    }
+
+    cell->next = list->head;
+    list->head = cell;
+    return 1;
+}
+
 void displayList(t_list list) {
     t_cell* curr;
     curr = list.head;
@@ -38,6 +38,18 @@ void displayList(t_list list);
  */
 int addCell(t_list* list, int vertex, double weight);
 
+/**
+ * @brief Adds a new cell taken from an arena at the head of the list
+ * @param list Pointer to the list
+ * @param arena The arena owning the new cell
+ * @param vertex The vertex identifier for the new cell
+ * @param weight The weight value for the new cell
+ * @return 1 on success, -1 on failure (NULL list or allocation error)
+ * @note A list built this way must not be passed to freeList(): its cells are
+ *       released by freeCellArena()
+ */
+int addArenaCell(t_list* list, t_cell_arena* arena, int vertex, double weight);
+
 /**
  * @brief Frees all cells in the list
  * @param list Pointer to the list to free
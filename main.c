@@ -1,17 +1,138 @@
+#include <errno.h>
+#include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "graph.h"
 #include "mermaidchart-file-generator.h"
 #include "utils.h"
 #include "partition.h"
 #include "tests.h"
+#include "bench.h"
 #include "matrix.h"
 #include "tarjan.h"
+#include "graph_binary.h"
+#include "stationary.h"
+#include "simulation.h"
+
+/**
+ * @brief Prints the command line of the simulation mode.
+ */
+static void printSimulationUsage(const char *program) {
+    fprintf(stderr, "Usage: %s --graph graph.txt --simulate steps --initial state [--walkers n] [--seed s] [--threads t]\n",
+            program);
+}
+
+/**
+ * @brief Parses a whole decimal option value (no trailing characters).
+ * @return 1 if value is an integer in [min, max], 0 otherwise.
+ */
+static int parseIntegerOption(const char *value, long long min, long long max, long long *result) {
+    char *end = NULL;
+    errno = 0;
+    long long parsed = strtoll(value, &end, 10);
+    if (end == value || *end != '\0' || errno == ERANGE || parsed < min || parsed > max) return 0;
+    *result = parsed;
+    return 1;
+}
+
+/**
+ * @brief Simulation mode: TI_301_PJT --graph graphe.txt --simulate 20 --initial 1 [--walkers N] [--seed S] [--threads T]
+ *
+ * The initial state may be written with an "S" prefix (S1). The histograms
+ * only depend on the seed, not on the number of threads.
+ *
+ * @return 0 on success, 1 on error.
+ */
+static int runSimulationCommand(int argc, char **argv) {
+    const char *graph_path = NULL;
+    int steps = -1, initial_state = -1;
+    long long walkers = SIMULATION_DEFAULT_WALKERS;
+    unsigned long long seed = 1;
+    int thread_count = 0;
+    // Options par paires : une option sans valeur est une erreur, pas un oubli silencieux
+    if ((argc - 1) % 2 != 0) {
+        fprintf(stderr, "Option %s has no value\n", argv[argc - 1]);
+        printSimulationUsage(argv[0]);
+        return 1;
+    }
+    for (int i = 1; i < argc; i += 2) {
+        const char *value = argv[i + 1];
+        long long number = 0;
+        int valid = 1;
+        if (strcmp(argv[i], "--graph") == 0) {
+            graph_path = value;
+        } else if (strcmp(argv[i], "--simulate") == 0) {
+            valid = parseIntegerOption(value, 0, INT_MAX, &number);
+            steps = (int)number;
+        } else if (strcmp(argv[i], "--initial") == 0) {
+            valid = parseIntegerOption(value + (value[0] == 'S' || value[0] == 's'), 1, INT_MAX, &number);
+            initial_state = (int)number;
+        } else if (strcmp(argv[i], "--walkers") == 0) {
+            valid = parseIntegerOption(value, 1, LLONG_MAX, &number);
+            walkers = number;
+        } else if (strcmp(argv[i], "--seed") == 0) {
+            char *end = NULL;
+            errno = 0;
+            seed = strtoull(value, &end, 10);
+            valid = value[0] >= '0' && value[0] <= '9' && *end == '\0' && errno != ERANGE;
+        } else if (strcmp(argv[i], "--threads") == 0) {
+            valid = parseIntegerOption(value, 0, INT_MAX, &number);
+            thread_count = (int)number;
+        } else {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            printSimulationUsage(argv[0]);
+            return 1;
+        }
+        if (!valid) {
+            fprintf(stderr, "Invalid value '%s' for option %s\n", value, argv[i]);
+            printSimulationUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (graph_path == NULL || steps < 0 || initial_state < 1) {
+        printSimulationUsage(argv[0]);
+        return 1;
+    }
+    // Les compteurs d'occupation cumulent walkers x steps visites
+    if (walkers > getMaxSimulationWalkers(steps)) {
+        fprintf(stderr, "Too many walkers for %d steps (at most %lld)\n", steps, getMaxSimulationWalkers(steps));
+        printSimulationUsage(argv[0]);
+        return 1;
+    }
+
+    t_graph graph = importGraphFromFile(graph_path);
+    if (graph.size == 0) {
+        fprintf(stderr, "Failed to import graph from file.\n");
+        return 1;
+    }
+    t_walk_sampler sampler = createEmptyWalkSampler();
+    t_simulation simulation = createEmptySimulation();
+    int ok = createWalkSampler(graph, &sampler) == 1;
+    ok = ok && simulateRandomWalksParallel(&sampler, initial_state, walkers, steps, seed, thread_count,
+                                           &simulation) == 1;
+    if (ok) displaySimulation(simulation);
+    freeSimulation(&simulation);
+    freeWalkSampler(&sampler);
+    freeGraph(&graph);
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    // Mode conversion : TI_301_PJT --to-binary graphe.txt graphe.bin
+    if (argc == 4 && strcmp(argv[1], "--to-binary") == 0) {
+        return convertGraphFileToBinary(argv[2], argv[3]) ? 0 : 1;
+    }
+    // Mode simulation : TI_301_PJT --graph graphe.txt --simulate 20 --initial 1
+    if (argc >= 3 && strcmp(argv[1], "--graph") == 0) {
+        return runSimulationCommand(argc, argv);
+    }
 
-int main(void) {
     char* path = "../test_bench/exemple1.txt";
     char* graph_path = "../results/exemple_graph.mmd";
     char* hasse_path = "../results/exemple_hasse.mmd";
     int unit_tests = FALSE;
+    int benchmarks = FALSE;
 
     t_graph graph = importGraphFromFile(path);
     if (graph.size == 0) {
@@ -73,7 +194,13 @@ int main(void) {
     printf("\n========= Validation 2 =========\n");
     printf("We want to obtain the stationary distributions for each of the graph’s classes.\n");
     printf("=== Stationary distributions for all classes ===\n");
-    computeStationaryDistributionsForAllClasses(matrix,*partition,hasse,0.01);
+    computeStationaryDistributionsForAllClasses(matrix,*partition,hasse,STATIONARY_DEFAULT_TOLERANCE);
+
+    if (benchmarks == TRUE) {
+        printf("\n==================================[ BENCHMARKS ]==================================\n");
+        register_project_benchmarks();
+        run_all_benchmarks();
+    }
 
     if (unit_tests == TRUE) {
         printf("\n==================================[ UNIT TESTS ]==================================\n");
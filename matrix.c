@@ -1,6 +1,13 @@
 #include "matrix.h"
 #include "utils.h"
+#include "stationary.h"
 #include <math.h>
+#include <string.h>
+#include <pthread.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define MATRIX_HAS_X86_KERNELS 1
+#endif
 
 /**
  * @file matrix.c
@@ -14,7 +21,7 @@
  * @return A matrix with rows=0, cols=0, data=NULL.
  */
 static t_matrix createEmptyMatrix() {
-    t_matrix m = {0, 0, NULL};
+    t_matrix m = {0, 0, NULL, NULL, 0};
     return m;
 }
 
@@ -155,30 +162,127 @@ static int diffMatricesParamsValid(t_matrix a, t_matrix b) {
 }
 
 /**
- * @brief Recursive function for exponentiation by repeated multiplication.
- * @param m Base matrix.
- * @param power Current exponent.
- * @param result Result matrix (already allocated).
- * @return 1 on success, -1 on error.
+ * @brief Tile sizes of the blocked product: a MULTIPLY_TILE_K x MULTIPLY_TILE_J
+ *        block of B (256 KiB) stays in the L2 cache while every row of A uses it.
  */
-static int powerMatrixRec(t_matrix m, int power, t_matrix *result) {
-    if (power == 0) {
-        // Retourner la matrice identité
-        for (int i = 0; i < m.rows; i++) {
-            for (int j = 0; j < m.cols; j++) {
-                result->data[i][j] = (i == j) ? 1.0 : 0.0;
-            }
-        }
-        return 1;
+#define MULTIPLY_TILE_K 128
+#define MULTIPLY_TILE_J 256
+
+/**
+ * @brief Inner loop of the product: c[j] += alpha * b[j] for j in [0, count).
+ */
+typedef void (*t_axpy_row_fn)(double *c, const double *b, double alpha, int count);
+
+/**
+ * @brief Keeps every multiplication and addition separately rounded: GCC would
+ *        otherwise fuse them into FMA instructions where the target has them
+ *        (avx512f, -march=native) and the kernels would no longer agree.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+#define MATRIX_NO_FP_CONTRACT __attribute__((optimize("fp-contract=off")))
+#else
+#define MATRIX_NO_FP_CONTRACT
+#endif
+
+MATRIX_NO_FP_CONTRACT
+static void axpyRowScalar(double *c, const double *b, double alpha, int count) {
+    for (int j = 0; j < count; j++) {
+        c[j] += alpha * b[j];
+    }
+}
+
+#ifdef MATRIX_HAS_X86_KERNELS
+// Multiplication puis addition séparées (pas de FMA) : même arrondi que la boucle scalaire
+MATRIX_NO_FP_CONTRACT __attribute__((target("avx2")))
+static void axpyRowAvx2(double *c, const double *b, double alpha, int count) {
+    __m256d va = _mm256_set1_pd(alpha);
+    int j = 0;
+    for (; j + 8 <= count; j += 8) {
+        __m256d c0 = _mm256_add_pd(_mm256_loadu_pd(c + j), _mm256_mul_pd(va, _mm256_loadu_pd(b + j)));
+        __m256d c1 = _mm256_add_pd(_mm256_loadu_pd(c + j + 4), _mm256_mul_pd(va, _mm256_loadu_pd(b + j + 4)));
+        _mm256_storeu_pd(c + j, c0);
+        _mm256_storeu_pd(c + j + 4, c1);
+    }
+    for (; j < count; j++) {
+        c[j] += alpha * b[j];
+    }
+}
+
+MATRIX_NO_FP_CONTRACT __attribute__((target("avx512f")))
+static void axpyRowAvx512(double *c, const double *b, double alpha, int count) {
+    __m512d va = _mm512_set1_pd(alpha);
+    int j = 0;
+    for (; j + 16 <= count; j += 16) {
+        __m512d c0 = _mm512_add_pd(_mm512_loadu_pd(c + j), _mm512_mul_pd(va, _mm512_loadu_pd(b + j)));
+        __m512d c1 = _mm512_add_pd(_mm512_loadu_pd(c + j + 8), _mm512_mul_pd(va, _mm512_loadu_pd(b + j + 8)));
+        _mm512_storeu_pd(c + j, c0);
+        _mm512_storeu_pd(c + j + 8, c1);
     }
-    if (power == 1) {
-        // Retourner la matrice elle-même
-        return copyMatrix(m, result);
+    if (j + 8 <= count) {
+        __m512d c0 = _mm512_add_pd(_mm512_loadu_pd(c + j), _mm512_mul_pd(va, _mm512_loadu_pd(b + j)));
+        _mm512_storeu_pd(c + j, c0);
+        j += 8;
+    }
+    if (j < count) {
+        // Fin de ligne : accès masqués aux (count - j) < 8 éléments restants
+        __mmask8 mask = (__mmask8)((1u << (count - j)) - 1u);
+        __m512d c0 = _mm512_add_pd(_mm512_maskz_loadu_pd(mask, c + j),
+                                   _mm512_mul_pd(va, _mm512_maskz_loadu_pd(mask, b + j)));
+        _mm512_mask_storeu_pd(c + j, mask, c0);
     }
-    t_matrix temp;
-    powerMatrix(m, power - 1, &temp);
-    multiplyMatrices(m, temp, result);
-    freeMatrix(&temp);
+}
+#endif
+
+static t_matrix_kernel g_matrix_kernel = MATRIX_KERNEL_AUTO;
+static t_axpy_row_fn g_axpy_row = NULL;
+
+/**
+ * @brief Tell whether the CPU and the build support a kernel.
+ * @param kernel Kernel to check (not MATRIX_KERNEL_AUTO).
+ * @return TRUE if supported, FALSE otherwise.
+ */
+static int isMatrixKernelSupported(t_matrix_kernel kernel) {
+    switch (kernel) {
+        case MATRIX_KERNEL_SCALAR:
+            return TRUE;
+#ifdef MATRIX_HAS_X86_KERNELS
+        case MATRIX_KERNEL_AVX2:
+            return __builtin_cpu_supports("avx2") ? TRUE : FALSE;
+        case MATRIX_KERNEL_AVX512:
+            return __builtin_cpu_supports("avx512f") ? TRUE : FALSE;
+#endif
+        default:
+            return FALSE;
+    }
+}
+
+/**
+ * @brief Get the inner loop of the current kernel, detecting it on first use.
+ * @return The inner loop function.
+ */
+static t_axpy_row_fn getAxpyRow(void) {
+    if (g_axpy_row == NULL) selectMatrixKernel(MATRIX_KERNEL_AUTO);
+    return g_axpy_row;
+}
+
+/**
+ * @brief Fill a square matrix with the identity.
+ * @param m Matrix to fill (already allocated).
+ */
+static void setIdentityMatrix(t_matrix m) {
+    memset(m.values, 0, (size_t)m.rows * (size_t)m.stride * sizeof(double));
+    for (int i = 0; i < m.rows; i++) {
+        m.data[i][i] = 1.0;
+    }
+}
+
+/**
+ * @brief Swap two matrix descriptors (used to ping-pong between buffers).
+ */
+static void swapMatrices(t_matrix *a, t_matrix *b) {
+    t_matrix tmp = *a;
+    *a = *b;
+    *b = tmp;
 }
 
 /**
@@ -207,15 +311,18 @@ static void displayMatrixData(t_matrix m) {
  * @param hasse Hasse diagram (persistent / transient info).
  * @param class Pointer to the class to process.
  * @param epsilon Convergence threshold.
+ * @param converged Set to 0 if the solver did not converge, 1 otherwise.
  * @return the stationary distribution of that class.
- *         Zero matrix if the class is transient.
+ *         Zero matrix if the class is transient or did not converge.
  */
 static t_matrix computeStationaryDistributionForOneClass(
         t_matrix M,
         t_partition part,
         t_hasse_diagram hasse,
         t_class *class,
-        double epsilon) {
+        double epsilon,
+        int *converged) {
+    *converged = 1;
     if (class == NULL) {
         fprintf(stderr, "computeStationaryDistributionForOneClass: NULL class pointer\n");
         return createMatrix(0, 0);
@@ -241,29 +348,150 @@ static t_matrix computeStationaryDistributionForOneClass(
         return zero;
     }
 
-    // La matrice est persistante.
-    t_matrix limit;
-    int n = computeConvergedMatrixPower(subM, epsilon, &limit, 2000);
-
-    if (n == -1) {
-        printf("Class %s did not converge.\n", getID(class_id));
-        t_matrix zero = createMatrix(1, size);
+    // La classe est persistante : résolution directe pour les petites classes,
+    // sinon itérations sur des vecteurs, paresseuses si la classe est périodique
+    t_sparse_matrix sparse;
+    if (createSparseMatrixFromMatrix(subM, &sparse) < 0) {
         freeMatrix(&subM);
-        return zero;
+        return createMatrix(0, 0);
     }
-
-    // Extraction de la distribution stationnaire
-    // La distribution stationnaire est la première ligne de la matrice limite
     t_matrix distrib = createMatrix(1, size);
-    for (int j = 0; j < size; j++)
-        distrib.data[0][j] = limit.data[0][j];
+    if (solveStationaryDistributionWithPeriod(sparse, STATIONARY_SOLVER_AUTO, class->period, epsilon,
+                                              distrib.data[0]) == -1) {
+        *converged = 0;
+        memset(distrib.values, 0, (size_t)distrib.rows * distrib.stride * sizeof(double));
+    }
 
-    freeMatrix(&limit);
+    freeSparseMatrix(&sparse);
     freeMatrix(&subM);
 
     return distrib;
 }
 
+/**
+ * @brief Shared state of the workers of computeStationaryDistributions().
+ * @param order Indices (in class list order) of the classes, largest first.
+ * @param next Next position of order to hand out, protected by lock.
+ */
+typedef struct s_stationary_jobs {
+    t_matrix M;
+    t_partition part;
+    t_hasse_diagram hasse;
+    double epsilon;
+    t_class **classes;
+    int *order;
+    int count;
+    int next;
+    pthread_mutex_t lock;
+    t_matrix *results;
+    int *converged;
+} t_stationary_jobs;
+
+/**
+ * @brief Worker: takes the next class (largest remaining first) until none is left.
+ */
+static void *solveStationaryJobs(void *arg) {
+    t_stationary_jobs *jobs = (t_stationary_jobs *)arg;
+    for (;;) {
+        pthread_mutex_lock(&jobs->lock);
+        int position = jobs->next++;
+        pthread_mutex_unlock(&jobs->lock);
+        if (position >= jobs->count) break;
+        // Résultat rangé à l'indice de la classe : l'ordre ne dépend pas des threads
+        int index = jobs->order[position];
+        jobs->results[index] = computeStationaryDistributionForOneClass(
+                jobs->M, jobs->part, jobs->hasse, jobs->classes[index], jobs->epsilon, &jobs->converged[index]);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Class size and list index, sorted to hand out the largest classes first.
+ */
+typedef struct s_class_size {
+    int size;
+    int index;
+} t_class_size;
+
+static int compareClassSizes(const void *a, const void *b) {
+    const t_class_size *ca = (const t_class_size *)a, *cb = (const t_class_size *)b;
+    if (ca->size != cb->size) return (ca->size < cb->size) - (ca->size > cb->size);
+    return (ca->index > cb->index) - (ca->index < cb->index);
+}
+
+/**
+ * @brief Looks for a closed periodic class in a stochastic matrix.
+ *
+ * M^n converges if and only if every closed class is aperiodic: the classes
+ * are found on a CSR copy of the non-zero entries, then their periods with
+ * computeClassPeriods().
+ *
+ * @param m Square matrix.
+ * @return The period (> 1) of a closed class, 0 if there is none or m is not stochastic, -1 on error.
+ */
+static int findPeriodicClosedClass(t_matrix m) {
+    int size = m.rows, nnz = 0;
+    for (int i = 0; i < size; i++) {
+        double sum = 0.0;
+        for (int j = 0; j < size; j++) {
+            if (m.data[i][j] < 0.0) return 0;
+            sum += m.data[i][j];
+            nnz += (m.data[i][j] > 0.0);
+        }
+        // Hors matrice stochastique, un bloc périodique peut tendre vers 0 : pas de conclusion
+        if (fabs(sum - 1.0) > 1e-9) return 0;
+    }
+
+    t_csr_graph csr = createEmptyCsrGraph();
+    csr.offsets = malloc(((size_t)size + 1) * sizeof(int));
+    csr.targets = malloc((size_t)nnz * sizeof(int));
+    csr.weights = malloc((size_t)nnz * sizeof(double));
+    int *association_array = malloc((size_t)size * sizeof(int));
+    if (csr.offsets == NULL || csr.targets == NULL || csr.weights == NULL || association_array == NULL) {
+        perror("computeConvergedMatrixPower: allocation failed");
+        freeCsrGraph(&csr);
+        free(association_array);
+        return -1;
+    }
+    csr.size = size;
+    csr.edge_count = nnz;
+    csr.offsets[0] = 0;
+    for (int i = 0, e = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            if (m.data[i][j] <= 0.0) continue;
+            csr.targets[e] = j + 1;
+            csr.weights[e++] = m.data[i][j];
+        }
+        csr.offsets[i + 1] = e;
+    }
+
+    int period = -1;
+    t_partition *partition = parallelSccQuiet(csr, 1);
+    int *leaves = (partition != NULL) ? calloc((size_t)partition->class_number + 1, sizeof(int)) : NULL;
+    if (leaves != NULL) {
+        for (t_class *c = partition->classes; c != NULL; c = c->next) {
+            for (t_vertex *v = c->vertices; v != NULL; v = v->next) association_array[v->value - 1] = c->id;
+        }
+        // Une classe est fermée si aucune arête n'en sort
+        for (int i = 0; i < size; i++) {
+            for (int e = csr.offsets[i]; e < csr.offsets[i + 1]; e++) {
+                if (association_array[csr.targets[e] - 1] != association_array[i]) leaves[association_array[i]] = 1;
+            }
+        }
+        if (computeClassPeriods(csr, partition, association_array) == 1) {
+            period = 0;
+            for (t_class *c = partition->classes; c != NULL && period == 0; c = c->next) {
+                if (!leaves[c->id] && c->period > 1) period = c->period;
+            }
+        }
+    }
+    free(leaves);
+    if (partition != NULL) freePartition(partition);
+    free(association_array);
+    freeCsrGraph(&csr);
+    return period;
+}
+
 /* public functions =================================================== */
 
 t_matrix createMatrix(const int rows, const int cols) {
@@ -272,37 +500,44 @@ t_matrix createMatrix(const int rows, const int cols) {
         fprintf(stderr, "createMatrix: invalid dimensions (%d x %d)\n", rows, cols);
         return m;
     };
+    // Chaque ligne commence sur une frontière de MATRIX_ALIGNMENT octets
+    const int per_line = MATRIX_ALIGNMENT / (int)sizeof(double);
+    int stride = (cols + per_line - 1) / per_line * per_line;
+    // Un pas multiple de 512 octets envoie toute une colonne dans les mêmes
+    // ensembles du cache : on ajoute une ligne de cache pour l'éviter
+    if (stride % (8 * per_line) == 0) stride += per_line;
+    size_t bytes = (size_t)rows * (size_t)stride * sizeof(double);
+
+    // Un seul bloc contigu pour toutes les valeurs (taille multiple de l'alignement)
+    m.values = (double*)aligned_alloc(MATRIX_ALIGNMENT, bytes);
     m.data = (double**)malloc(sizeof(double*) * rows);
-    if (m.data == NULL) {
+    if (m.values == NULL || m.data == NULL) {
         perror("createMatrix: memory allocation failed");
-        return m;
+        free(m.values);
+        free(m.data);
+        return createEmptyMatrix();
     };
+    memset(m.values, 0, bytes);
+
+    // Pointeurs de ligne dans le bloc contigu pour l'accès data[i][j]
     for (int i = 0; i < rows; ++i) {
-        m.data[i] = (double*)calloc(cols, sizeof(double));
-        if (m.data[i] == NULL) {
-            perror("createMatrix: row allocation failed");
-            // Free already allocated rows
-            for (int j = 0; j < i; ++j) {
-                free(m.data[j]);
-            }
-            free(m.data);
-            return createEmptyMatrix();
-        }
+        m.data[i] = m.values + (size_t)i * (size_t)stride;
     }
     m.rows = rows;
     m.cols = cols;
+    m.stride = stride;
     return m;
 }
 
 void freeMatrix(t_matrix *m) {
     if (isEmptyMatrix(*m)) return;
-    for (int i = 0; i < m->rows; ++i) {
-        free(m->data[i]);
-    }
+    free(m->values);
     free(m->data);
-    m->data = NULL;
-    m->rows = 0;
-    m->cols = 0;
+    *m = createEmptyMatrix();
+}
+
+double *getMatrixRow(t_matrix m, int row) {
+    return m.values + (size_t)row * (size_t)m.stride;
 }
 
 int isEmptyMatrix(t_matrix m) {
@@ -320,10 +555,13 @@ void displayMatrix(t_matrix m) {
 
 int copyMatrix(t_matrix src, t_matrix *dest) {
     if (copyMatrixParamsValid(src, dest) == FALSE) return -1;
+    if (src.stride == dest->stride) {
+        // Même disposition : une seule copie du bloc contigu
+        memcpy(dest->values, src.values, (size_t)src.rows * (size_t)src.stride * sizeof(double));
+        return 1;
+    }
     for (int i = 0; i < src.rows; ++i) {
-        for (int j = 0; j < src.cols; ++j) {
-            dest->data[i][j] = src.data[i][j];
-        }
+        memcpy(getMatrixRow(*dest, i), getMatrixRow(src, i), (size_t)src.cols * sizeof(double));
     }
     return 1;
 }
@@ -333,17 +571,77 @@ int multiplyMatrices(t_matrix a, t_matrix b, t_matrix *result) {
 
     if (createResultMatrix(result, a.rows, b.cols) < 0) return -1;
 
-    for (int i = 0; i < a.rows; ++i) {
-        for (int j = 0; j < b.cols; ++j) {
-            result->data[i][j] = 0.0;
-            for (int k = 0; k < a.cols; ++k) {
-                result->data[i][j] += a.data[i][k] * b.data[k][j];
+    return multiplyMatricesInto(a, b, *result);
+}
+
+int multiplyMatricesInto(t_matrix a, t_matrix b, t_matrix result) {
+    if (multiplyMatricesParamsValid(a, b, &result) == FALSE) return -1;
+    if (!isValidMatrix(result) || result.rows != a.rows || result.cols != b.cols) {
+        fprintf(stderr, "multiplyMatricesInto: result must be an allocated %dx%d matrix\n", a.rows, b.cols);
+        return -1;
+    }
+    if (result.values == a.values || result.values == b.values) {
+        fprintf(stderr, "multiplyMatricesInto: result must not be an operand\n");
+        return -1;
+    }
+    memset(result.values, 0, (size_t)result.rows * (size_t)result.stride * sizeof(double));
+
+    // Produit i-k-j par blocs : un bloc de B reste en cache pendant que chaque
+    // ligne de A l'utilise, et la boucle interne parcourt des lignes contiguës.
+    // Pour un (i, j) donné, les produits sont ajoutés par k croissant.
+    t_axpy_row_fn axpy_row = getAxpyRow();
+    for (int k0 = 0; k0 < a.cols; k0 += MULTIPLY_TILE_K) {
+        int k1 = minInt(k0 + MULTIPLY_TILE_K, a.cols);
+        for (int j0 = 0; j0 < b.cols; j0 += MULTIPLY_TILE_J) {
+            int width = minInt(MULTIPLY_TILE_J, b.cols - j0);
+            for (int i = 0; i < a.rows; ++i) {
+                const double *a_row = getMatrixRow(a, i);
+                double *result_row = getMatrixRow(result, i) + j0;
+                for (int k = k0; k < k1; ++k) {
+                    axpy_row(result_row, getMatrixRow(b, k) + j0, a_row[k], width);
+                }
             }
         }
     }
     return 1;
 }
 
+int selectMatrixKernel(t_matrix_kernel kernel) {
+    if (kernel == MATRIX_KERNEL_AUTO) {
+        kernel = isMatrixKernelSupported(MATRIX_KERNEL_AVX512) ? MATRIX_KERNEL_AVX512
+               : isMatrixKernelSupported(MATRIX_KERNEL_AVX2) ? MATRIX_KERNEL_AVX2
+               : MATRIX_KERNEL_SCALAR;
+    }
+    if (!isMatrixKernelSupported(kernel)) {
+        fprintf(stderr, "selectMatrixKernel: kernel '%s' not supported\n", getMatrixKernelName(kernel));
+        return -1;
+    }
+    switch (kernel) {
+#ifdef MATRIX_HAS_X86_KERNELS
+        case MATRIX_KERNEL_AVX2: g_axpy_row = axpyRowAvx2; break;
+        case MATRIX_KERNEL_AVX512: g_axpy_row = axpyRowAvx512; break;
+#endif
+        default: g_axpy_row = axpyRowScalar; break;
+    }
+    g_matrix_kernel = kernel;
+    return 1;
+}
+
+t_matrix_kernel getMatrixKernel(void) {
+    getAxpyRow();
+    return g_matrix_kernel;
+}
+
+const char *getMatrixKernelName(t_matrix_kernel kernel) {
+    switch (kernel) {
+        case MATRIX_KERNEL_AUTO: return "auto";
+        case MATRIX_KERNEL_SCALAR: return "scalar";
+        case MATRIX_KERNEL_AVX2: return "avx2";
+        case MATRIX_KERNEL_AVX512: return "avx512";
+        default: return "unknown";
+    }
+}
+
 int setMatrixValue(t_matrix *m, const int row, const int col, const double value) {
     if (setMatrixValueParamsValid(m, row, col) == FALSE) return -1;
     m->data[row][col] = value;
@@ -354,8 +652,64 @@ int powerMatrix(t_matrix m, int power, t_matrix *result) {
     if (powerMatrixParamsValid(m, power, result) == FALSE) return -1;
 
     if (createResultMatrix(result, m.rows, m.cols) < 0) return -1;
+    if (power == 0) {
+        setIdentityMatrix(*result);
+        return 1;
+    }
 
-    return powerMatrixRec(m, power, result);
+    // Exponentiation rapide : base = M^(2^i), produit dans un tampon puis échange.
+    // Deux tampons de travail suffisent, quel que soit l'exposant.
+    t_matrix base, scratch;
+    if (createResultMatrix(&base, m.rows, m.cols) < 0) {
+        freeMatrix(result);
+        return -1;
+    }
+    if (createResultMatrix(&scratch, m.rows, m.cols) < 0) {
+        freeMatrix(&base);
+        freeMatrix(result);
+        return -1;
+    }
+    copyMatrix(m, &base);
+
+    int status = 1;
+    int result_is_identity = TRUE;
+    while (power > 0 && status > 0) {
+        if (power & 1) {
+            if (result_is_identity) {
+                // I x base = base : une copie suffit
+                status = copyMatrix(base, result);
+                result_is_identity = FALSE;
+            } else {
+                status = multiplyMatricesInto(*result, base, scratch);
+                swapMatrices(result, &scratch);
+            }
+        }
+        power >>= 1;
+        if (power > 0 && status > 0) {
+            status = multiplyMatricesInto(base, base, scratch);
+            swapMatrices(&base, &scratch);
+        }
+    }
+
+    freeMatrix(&base);
+    freeMatrix(&scratch);
+    if (status < 0) freeMatrix(result);
+    return status;
+}
+
+int setMatrixData(t_matrix *m, double* data, int dataSize) {
+    if (m == NULL || !isValidMatrix(*m)) {
+        fprintf(stderr, "setMatrixData: invalid matrix\n");
+        return -1;
+    }
+    if (data == NULL || dataSize != m->rows * m->cols) {
+        fprintf(stderr, "setMatrixData: expected %d values (got %d)\n", m->rows * m->cols, dataSize);
+        return -1;
+    }
+    for (int i = 0; i < m->rows; ++i) {
+        memcpy(getMatrixRow(*m, i), data + (size_t)i * (size_t)m->cols, (size_t)m->cols * sizeof(double));
+    }
+    return 1;
 }
 
 double diffMatrices(t_matrix a, t_matrix b) {
@@ -388,14 +742,34 @@ int createMatrixFromGraph(t_graph g, t_matrix *result) {
         }
         t_cell* curr = curr_list->head;
         while (curr != NULL) {
-            // (curr->vertex - 1) = indice du vertex courant dans la matrice
-            result->data[i][curr->vertex - 1] = curr->weight;
+            // (curr->vertex - 1) = indice du vertex courant ; les arêtes en double s'additionnent
+            result->data[i][curr->vertex - 1] += curr->weight;
             curr = curr->next;
         }
     }
     return 1;
 }
 
+int createMatrixFromCsrGraph(t_csr_graph g, t_matrix *result) {
+    if (result == NULL) {
+        fprintf(stderr, "createMatrixFromCsrGraph: no result matrix provided\n");
+        return -1;
+    }
+    if (isEmptyCsrGraph(g)) {
+        fprintf(stderr, "createMatrixFromCsrGraph: graph is not initialized\n");
+        return -1;
+    }
+
+    if (createResultMatrix(result, g.size, g.size) < 0) return -1;
+
+    for (int i = 0; i < g.size; i++) {
+        for (int e = g.offsets[i]; e < g.offsets[i + 1]; e++) {
+            result->data[i][g.targets[e] - 1] += g.weights[e];
+        }
+    }
+    return 1;
+}
+
 t_matrix buildSubMatrix(t_matrix matrix, t_partition part, int class_id) {
     // Recherche de la classe correspondant à class_id dans la partition.
     // La partition est une liste chaînée de classes.
@@ -482,46 +856,70 @@ t_matrix buildSubMatrixFromVertices(t_matrix matrix, int* vertices, int vertexCo
 }
 
 int computeConvergedMatrixPower(t_matrix matrix, double epsilon, t_matrix *limitMatrix, int maxIter) {
+    return computeConvergedMatrixPowerWithMode(matrix, epsilon, limitMatrix, maxIter, CONVERGENCE_INCREMENTAL);
+}
+
+int computeConvergedMatrixPowerWithMode(t_matrix matrix, double epsilon, t_matrix *limitMatrix, int maxIter,
+                                        t_convergence_mode mode) {
     if (!isValidMatrix(matrix) || matrix.rows != matrix.cols) {
         fprintf(stderr, "computeConvergedMatrixPower: invalid input matrix\n");
         return -1;
     }
+    if (limitMatrix == NULL) {
+        fprintf(stderr, "computeConvergedMatrixPower: no result matrix provided\n");
+        return -1;
+    }
 
-    // Calculer M^1
-    // C'est égal à la matrice elle-même donc on initialise prev avec matrix
-    t_matrix prev;
+    // Une classe fermée périodique fait osciller M^n indéfiniment : inutile d'itérer
+    int period = findPeriodicClosedClass(matrix);
+    if (period > 1) {
+        fprintf(stderr, "computeConvergedMatrixPower: a closed class has period %d, M^n does not converge\n",
+                period);
+        return -1;
+    }
+
+    // prev = M^n (M^1 au départ), curr reçoit la puissance suivante puis les
+    // deux tampons sont échangés : aucune allocation dans la boucle
+    t_matrix prev, curr;
     if (createResultMatrix(&prev, matrix.rows, matrix.rows) < 0) return -1;
+    if (createResultMatrix(&curr, matrix.rows, matrix.rows) < 0) {
+        freeMatrix(&prev);
+        return -1;
+    }
     copyMatrix(matrix, &prev);
 
-    t_matrix curr;
-
-    for (int n = 2; n <= maxIter; n++) {
-        // Calculer M^n
-        if (powerMatrix(matrix, n, &curr) < 0) {
-            freeMatrix(&prev);
-            return -1;
+    int n = 1;
+    while (n < maxIter) {
+        int next;
+        int status;
+        if (mode == CONVERGENCE_DOUBLING) {
+            // M^(2n) = M^n x M^n
+            if (n > maxIter / 2) break;
+            next = 2 * n;
+            status = multiplyMatricesInto(prev, prev, curr);
+        } else {
+            // M^(n+1) = M^n x M
+            next = n + 1;
+            status = multiplyMatricesInto(prev, matrix, curr);
         }
+        if (status < 0) break;
 
-        // Calculer la différence entre M^(n-1) et M^n (diff(M^(n-1), M^n))
+        // Calculer la différence entre l'ancienne et la nouvelle puissance
         double diff = diffMatrices(prev, curr);
+        swapMatrices(&prev, &curr);
+        n = next;
 
         if (diff < epsilon) {
-            // La convergence est atteinte
-            // Retourner n et la matrice M^n
-            *limitMatrix = curr;
-            freeMatrix(&prev);
+            // La convergence est atteinte : retourner n et la matrice M^n
+            *limitMatrix = prev;
+            freeMatrix(&curr);
             return n;
         }
-
-        // Libérer prev pour préparer pour la prochaine itération
-        freeMatrix(&prev);
-        prev = curr;
     }
 
     // Pas de convergence atteinte dans le nombre maximal d'itérations
-    // Libérer la dernière matrice calculée
-    // et retourner -1
     freeMatrix(&prev);
+    freeMatrix(&curr);
     return -1;
 }
 
@@ -538,32 +936,119 @@ void dipslayConvergedMatrixPower(t_matrix matrix, double epsilon, int maxIter) {
 }
 
 /**
- * @brief Compute and display stationary distributions for all classes.
+ * @brief Compute the stationary distributions of all classes on several threads.
+ *
+ * Classes are independent: they are handed out to a pool of threads, largest
+ * first, and each persistent class is solved by solveStationaryDistribution()
+ * (direct GTH elimination for small classes, lazy iteration otherwise).
+ * Results do not depend on the number of threads.
  *
  * @param M Full adjacency matrix.
  * @param part Graph partition.
  * @param hasse Hasse diagram.
- * @param epsilon Convergence threshold.
+ * @param epsilon Residual threshold ||pi P - pi||_1 of each distribution.
+ * @param thread_count Number of threads (<= 0: MARKOV_DEFAULT_THREADS, see resolveThreadCount()).
+ * @param results Array with one entry per class, filled in class list order
+ *        (zero row vector for transient or non-converging classes).
+ * @return 1 on success, -1 on error.
  */
+int computeStationaryDistributions(
+        t_matrix M,
+        t_partition part,
+        t_hasse_diagram hasse,
+        double epsilon,
+        int thread_count,
+        t_matrix *results)
+{
+    if (!isValidMatrix(M) || results == NULL) {
+        fprintf(stderr, "computeStationaryDistributions: invalid parameters\n");
+        return -1;
+    }
+    int count = 0;
+    for (t_class *c = part.classes; c != NULL; c = c->next) count++;
+    if (count == 0) return 1;
+
+    t_stationary_jobs jobs = { .M = M, .part = part, .hasse = hasse, .epsilon = epsilon,
+                               .count = count, .next = 0, .results = results };
+    jobs.classes = malloc((size_t)count * sizeof *jobs.classes);
+    jobs.order = malloc((size_t)count * sizeof *jobs.order);
+    jobs.converged = malloc((size_t)count * sizeof *jobs.converged);
+    t_class_size *sizes = malloc((size_t)count * sizeof *sizes);
+    int workers = minInt(resolveThreadCount(thread_count), count);
+    pthread_t *threads = malloc((size_t)workers * sizeof *threads);
+    int *started = calloc((size_t)workers, sizeof *started);
+    if (jobs.classes == NULL || jobs.order == NULL || jobs.converged == NULL || sizes == NULL ||
+        threads == NULL || started == NULL) {
+        perror("computeStationaryDistributions: allocation failed");
+        free(jobs.classes);
+        free(jobs.order);
+        free(jobs.converged);
+        free(sizes);
+        free(threads);
+        free(started);
+        return -1;
+    }
+
+    // Les plus grandes classes d'abord : la dernière classe distribuée est courte
+    int index = 0;
+    for (t_class *c = part.classes; c != NULL; c = c->next, index++) {
+        jobs.classes[index] = c;
+        sizes[index].size = c->vertex_number;
+        sizes[index].index = index;
+    }
+    qsort(sizes, (size_t)count, sizeof *sizes, compareClassSizes);
+    for (int i = 0; i < count; i++) jobs.order[i] = sizes[i].index;
+    free(sizes);
+
+    // Le thread appelant travaille aussi
+    pthread_mutex_init(&jobs.lock, NULL);
+    for (int t = 1; t < workers; t++) {
+        started[t] = (pthread_create(&threads[t], NULL, solveStationaryJobs, &jobs) == 0);
+    }
+    solveStationaryJobs(&jobs);
+    for (int t = 1; t < workers; t++) {
+        if (started[t]) pthread_join(threads[t], NULL);
+    }
+    pthread_mutex_destroy(&jobs.lock);
+
+    for (int i = 0; i < count; i++) {
+        if (!jobs.converged[i]) printf("Class %s did not converge.\n", getID(jobs.classes[i]->id));
+    }
+    free(jobs.classes);
+    free(jobs.order);
+    free(jobs.converged);
+    free(threads);
+    free(started);
+    return 1;
+}
+
 void computeStationaryDistributionsForAllClasses(
         t_matrix M,
         t_partition part,
         t_hasse_diagram hasse,
         double epsilon)
 {
-    t_class *class = part.classes;
+    int count = 0;
+    for (t_class *c = part.classes; c != NULL; c = c->next) count++;
+    t_matrix *results = calloc((size_t)(count > 0 ? count : 1), sizeof *results);
+    if (results == NULL) {
+        perror("computeStationaryDistributionsForAllClasses: allocation failed");
+        return;
+    }
+    if (computeStationaryDistributions(M, part, hasse, epsilon, 0, results) < 0) {
+        free(results);
+        return;
+    }
 
-    while (class != NULL) {
+    // Affichage dans l'ordre de la partition, quel que soit l'ordre de calcul
+    int index = 0;
+    for (t_class *class = part.classes; class != NULL; class = class->next, index++) {
         displayClass(class);
         printf(": \n");
-
-        t_matrix distrib = computeStationaryDistributionForOneClass(M, part, hasse, class, epsilon);
-
-        displayMatrix(distrib);
-        freeMatrix(&distrib);
-
-        class = class->next;
+        displayMatrix(results[index]);
+        freeMatrix(&results[index]);
     }
+    free(results);
 }
 
 int computeDistributionAfterNSteps(t_matrix transitionMatrix,
@@ -616,21 +1101,27 @@ int computeDistributionAfterNSteps(t_matrix transitionMatrix,
         return copyMatrix(initialDistribution, result);
     }
 
-    // Calcul de M^n
-    t_matrix matrixPowerN;
-    if (powerMatrix(transitionMatrix, n, &matrixPowerN) < 0) {
-        fprintf(stderr, "computeDistributionAfterNSteps: failed to compute matrix power\n");
+    // n produits vecteur x matrice (O(n.N^2)) au lieu de former M^n (O(N^3 log n)) :
+    // result <- result x M, avec un second vecteur échangé à chaque pas
+    t_matrix next;
+    if (createResultMatrix(result, 1, initialDistribution.cols) < 0) return -1;
+    if (createResultMatrix(&next, 1, initialDistribution.cols) < 0) {
+        freeMatrix(result);
         return -1;
     }
+    copyMatrix(initialDistribution, result);
 
-    // Multiplication : distribution * M^n
-    if (multiplyMatrices(initialDistribution, matrixPowerN, result) < 0) {
-        fprintf(stderr, "computeDistributionAfterNSteps: failed to multiply matrices\n");
-        freeMatrix(&matrixPowerN);
-        return -1;
+    for (int step = 0; step < n; step++) {
+        if (multiplyMatricesInto(*result, transitionMatrix, next) < 0) {
+            fprintf(stderr, "computeDistributionAfterNSteps: failed to multiply matrices\n");
+            freeMatrix(&next);
+            freeMatrix(result);
+            return -1;
+        }
+        swapMatrices(result, &next);
     }
 
-    freeMatrix(&matrixPowerN);
+    freeMatrix(&next);
     return 1;
 }
 
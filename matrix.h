@@ -3,7 +3,7 @@
 
 #include "graph.h"
 #include "partition.h"
-#include "graph.h"
+#include "csr_graph.h"
 #include "hasse.h"
 
 /**
@@ -11,17 +11,29 @@
  * @brief Matrix module providing basic creation, validation and operations (copy, multiply, power, difference).
  */
 
+/**
+ * @brief Alignment in bytes of the matrix storage and of every row.
+ */
+#define MATRIX_ALIGNMENT 64
+
 /**
  * @struct s_matrix
  * @brief Represents a dynamic 2D matrix of doubles.
  * @param rows Number of rows.
  * @param cols Number of columns.
- * @param data Pointer to an array of row pointers (each row is an array of doubles).
+ * @param data Pointer to an array of row pointers into values (data[i][j] is
+ *        element (i, j)), kept so that element access reads like a 2D array.
+ * @param values Single contiguous row-major buffer holding every element,
+ *        aligned on MATRIX_ALIGNMENT bytes.
+ * @param stride Distance in doubles between two consecutive rows of values
+ *        (cols rounded up so that every row starts on MATRIX_ALIGNMENT bytes).
  */
 typedef struct s_matrix {
     int rows;
     int cols;
     double **data;
+    double *values;
+    int stride;
 } t_matrix;
 
 /**
@@ -29,9 +41,18 @@ typedef struct s_matrix {
  * @param rows Number of rows (must be > 0).
  * @param cols Number of columns (must be > 0).
  * @return A new matrix, or an empty matrix (data = NULL) on error.
+ * @note The elements are stored in one aligned contiguous buffer (see t_matrix).
  */
 t_matrix createMatrix(int rows, int cols);
 
+/**
+ * @brief Get a pointer to the first element of a row.
+ * @param m Matrix to access.
+ * @param row Zero-based row index (not checked).
+ * @return Pointer to the cols contiguous elements of the row.
+ */
+double *getMatrixRow(t_matrix m, int row);
+
 /**
  * @brief Free all memory associated with a matrix and reset its fields.
  * @param matrix Pointer to the matrix to free.
@@ -66,6 +87,14 @@ void displayMatrix(t_matrix matrix);
  */
 int createMatrixFromGraph(t_graph graph, t_matrix *result);
 
+/**
+ * @brief Build an adjacency/weight matrix from a CSR graph.
+ * @param graph Source CSR graph.
+ * @param result Pointer to destination matrix (allocated internally).
+ * @return 1 on success, -1 on error.
+ */
+int createMatrixFromCsrGraph(t_csr_graph graph, t_matrix *result);
+
 /**
  * @brief Copy matrix contents from source to destination (same dimensions required).
  * @param src Source matrix (must be valid).
@@ -80,9 +109,58 @@ int copyMatrix(t_matrix src, t_matrix *dest);
  * @param b Right operand.
  * @param result Pointer receiving the newly allocated result matrix.
  * @return 1 on success, -1 on error.
+ * @note Cache-blocked i-k-j product using the kernel chosen by
+ *       selectMatrixKernel(). Every kernel adds the products in increasing k
+ *       order without fused multiply-add (contraction is disabled on the
+ *       kernels and by -ffp-contract=off in CMakeLists.txt), so all of them
+ *       give results identical to the textbook triple loop.
  */
 int multiplyMatrices(t_matrix a, t_matrix b, t_matrix *result);
 
+/**
+ * @brief Multiply two matrices (A x B) into an already allocated matrix.
+ * @param a Left operand.
+ * @param b Right operand.
+ * @param result Destination, allocated with a.rows rows and b.cols columns.
+ *        It must not share its storage with a or b.
+ * @return 1 on success, -1 on error.
+ * @note Same product as multiplyMatrices(), without any allocation: lets a
+ *       loop reuse the same buffers at every iteration.
+ */
+int multiplyMatricesInto(t_matrix a, t_matrix b, t_matrix result);
+
+/**
+ * @enum e_matrix_kernel
+ * @brief Inner loop implementation used by multiplyMatrices().
+ */
+typedef enum e_matrix_kernel {
+    MATRIX_KERNEL_AUTO,     /**< Best kernel supported by the CPU (default) */
+    MATRIX_KERNEL_SCALAR,   /**< Portable C loop */
+    MATRIX_KERNEL_AVX2,     /**< 256-bit AVX2 loop (x86 only) */
+    MATRIX_KERNEL_AVX512    /**< 512-bit AVX-512F loop (x86 only) */
+} t_matrix_kernel;
+
+/**
+ * @brief Choose the kernel used by multiplyMatrices().
+ * @param kernel Kernel to use, or MATRIX_KERNEL_AUTO to detect the best one at runtime.
+ * @return 1 on success, -1 if the kernel is not supported by this CPU or build
+ *         (the current kernel is then kept).
+ */
+int selectMatrixKernel(t_matrix_kernel kernel);
+
+/**
+ * @brief Get the kernel currently used by multiplyMatrices().
+ * @return The kernel (never MATRIX_KERNEL_AUTO).
+ */
+t_matrix_kernel getMatrixKernel(void);
+
+/**
+ * @brief Get a printable name for a kernel.
+ * @param kernel The kernel.
+ * @return A static string ("scalar", "avx2", ...).
+ */
+const char *getMatrixKernelName(t_matrix_kernel kernel);
+
 /**
  * @brief Compute the element-wise absolute difference sum between two matrices.
  * @param a First matrix.
@@ -97,6 +175,8 @@ double diffMatrices(t_matrix a, t_matrix b);
  * @param power Exponent (>= 0).
  * @param result Pointer receiving the newly allocated result matrix.
  * @return 1 on success, -1 on error.
+ * @note Exponentiation by squaring: O(log power) products and two scratch
+ *       matrices, whatever the exponent.
  */
 int powerMatrix(t_matrix matrix, int power, t_matrix *result);
 
@@ -148,6 +228,13 @@ t_matrix buildSubMatrixFromVertices(t_matrix matrix, int* vertices, int vertexCo
  * @brief compute the smallest n such that diffMatrices(M^n, M^(n-1)) < epsilon.
  *        The resulting matrix M^n is returned through result.
  *
+ * M^n is obtained from M^(n-1) with one product, in two buffers reused at
+ * every iteration.
+ *
+ * A stochastic matrix with a closed class of period > 1 never converges:
+ * this is detected up front (computeClassPeriods(), O(N^2) on the dense
+ * matrix) and -1 is returned without any product.
+ *
  * @param matrix Input square matrix.
  * @param epsilon Convergence value.
  * @param result Pointer receiving the converged matrix (M^n).
@@ -156,6 +243,33 @@ t_matrix buildSubMatrixFromVertices(t_matrix matrix, int* vertices, int vertexCo
  */
 int computeConvergedMatrixPower(t_matrix matrix, double epsilon, t_matrix *result, int maxIter);
 
+/**
+ * @enum e_convergence_mode
+ * @brief Sequence of powers explored by computeConvergedMatrixPowerWithMode().
+ */
+typedef enum e_convergence_mode {
+    CONVERGENCE_INCREMENTAL,    /**< M, M^2, M^3, ...: one product per step */
+    CONVERGENCE_DOUBLING        /**< M, M^2, M^4, ...: one squaring per step */
+} t_convergence_mode;
+
+/**
+ * @brief Same as computeConvergedMatrixPower(), with a choice of the sequence of powers.
+ *
+ * In incremental mode M^(n-1) is carried forward, so each step costs a
+ * single product. In doubling mode each step squares the current power and
+ * the test is diffMatrices(M^(2n), M^n) < epsilon: slowly converging chains
+ * reach large exponents in log2(n) products.
+ *
+ * @param matrix Input square matrix.
+ * @param epsilon Convergence value.
+ * @param result Pointer receiving the converged matrix (M^n).
+ * @param maxIter Largest exponent tried.
+ * @param mode Sequence of powers to explore.
+ * @return int The exponent n where convergence occurs, or -1 if no convergence.
+ */
+int computeConvergedMatrixPowerWithMode(t_matrix matrix, double epsilon, t_matrix *result, int maxIter,
+                                        t_convergence_mode mode);
+
 /**
  * @brief Display the matrix obtained by computing the converged power of the input matrix.
  *
@@ -165,13 +279,41 @@ int computeConvergedMatrixPower(t_matrix matrix, double epsilon, t_matrix *resul
  */
 void dipslayConvergedMatrixPower(t_matrix matrix, double epsilon, int maxIter);
 
+/**
+ * @brief Compute the stationary distributions of all classes on several threads.
+ *
+ * Classes are independent: they are handed out to a pool of threads, largest
+ * first, and each persistent class is solved by solveStationaryDistribution()
+ * (direct GTH elimination for small classes, lazy iteration otherwise).
+ * Results do not depend on the number of threads.
+ *
+ * @param M Full adjacency matrix.
+ * @param part Graph partition.
+ * @param hasse Hasse diagram.
+ * @param epsilon Residual threshold ||pi P - pi||_1 of each distribution.
+ * @param thread_count Number of threads (<= 0: MARKOV_DEFAULT_THREADS, see resolveThreadCount()).
+ * @param results Array with one entry per class, filled in class list order
+ *        (zero row vector for transient or non-converging classes).
+ * @return 1 on success, -1 on error.
+ */
+int computeStationaryDistributions(
+        t_matrix M,
+        t_partition part,
+        t_hasse_diagram hasse,
+        double epsilon,
+        int thread_count,
+        t_matrix *results);
+
 /**
  * @brief Compute and display stationary distributions for all classes.
  *
+ * Uses computeStationaryDistributions() with the default number of threads,
+ * then displays the classes in partition order.
+ *
  * @param M Full adjacency matrix.
  * @param part Graph partition.
  * @param hasse Hasse diagram.
- * @param epsilon Convergence threshold.
+ * @param epsilon Residual threshold ||pi P - pi||_1 of each distribution.
  */
 void computeStationaryDistributionsForAllClasses(
         t_matrix M,
@@ -185,6 +327,8 @@ void computeStationaryDistributionsForAllClasses(
  * This function takes an initial probability distribution (row vector) and
  * computes the distribution after n steps by multiplying it with the transition
  * matrix raised to the power n: result = initialDistribution * M^n
+ * M^n is never formed: the row vector is multiplied n times by M, O(n.N^2).
+ * For sparse chains see propagateDistributionOnCsrGraph(), O(n.E).
  *
  * @param transitionMatrix The transition matrix of the Markov chain.
  * @param initialDistribution Initial probability distribution (1 x size row vector).
@@ -14,15 +14,15 @@ t_partition * createPartition(void){
 }
 
 /**
- * @brief Recursively frees all classes in a linked list
+ * @brief Frees all classes in a linked list
  * @param class Pointer to the first class to free
  */
 static void freeClasses(t_class *class){
-    if (class == NULL) {
-        return;
+    while (class != NULL) {
+        t_class *next = class->next;
+        freeClass(class);
+        class = next;
     }
-    freeClasses(class->next);
-    freeClass(class);
 }
 
 int freePartition(t_partition *partition){
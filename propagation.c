@@ -0,0 +1,117 @@
+#include "propagation.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* private functions =================================================== */
+
+/**
+ * @brief Checks the common parameters of the propagation functions.
+ * @param caller Name of the public function (for error messages).
+ * @param size Number of vertices of the graph (0 if not initialized).
+ * @param distribution Distribution array.
+ * @param steps Number of steps.
+ * @return 1 if valid, 0 otherwise.
+ */
+static int propagationParamsValid(const char *caller, int size, const double *distribution, int steps) {
+    if (size < MIN_SIZE_GRAPH) {
+        fprintf(stderr, "%s: graph is not initialized\n", caller);
+        return 0;
+    }
+    if (distribution == NULL) {
+        fprintf(stderr, "%s: NULL distribution\n", caller);
+        return 0;
+    }
+    if (steps < 0) {
+        fprintf(stderr, "%s: steps must be non-negative (given: %d)\n", caller, steps);
+        return 0;
+    }
+    return 1;
+}
+
+/* public functions =================================================== */
+
+int propagateDistributionOnGraph(t_graph graph, double *distribution, int steps,
+                                 t_distribution_callback callback, void *user_data) {
+    if (!propagationParamsValid("propagateDistributionOnGraph", graph.values ? graph.size : 0, distribution, steps)) {
+        return -1;
+    }
+    // Deux tampons échangés à chaque pas, le résultat est recopié à la fin si besoin
+    double *curr = distribution;
+    double *next = malloc((size_t)graph.size * sizeof *next);
+    if (next == NULL) {
+        perror("propagateDistributionOnGraph: allocation failed");
+        return -1;
+    }
+    double *scratch = next;
+
+    int done = 0;
+    while (done < steps) {
+        // next[dest] = somme sur les arêtes src -> dest de pi[src] * poids
+        memset(next, 0, (size_t)graph.size * sizeof *next);
+        for (int i = 0; i < graph.size; i++) {
+            double mass = curr[i];
+            if (mass == 0.0) continue;
+            for (t_cell *cur = graph.values[i].head; cur != NULL; cur = cur->next) {
+                next[cur->vertex - 1] += mass * cur->weight;
+            }
+        }
+        double *tmp = curr;
+        curr = next;
+        next = tmp;
+        done++;
+        if (callback != NULL && callback(done, curr, graph.size, user_data) != 0) break;
+    }
+    if (curr != distribution) {
+        memcpy(distribution, curr, (size_t)graph.size * sizeof *curr);
+    }
+    free(scratch);
+    return done;
+}
+
+int propagateDistributionOnCsrGraph(t_csr_graph graph, double *distribution, int steps,
+                                    t_distribution_callback callback, void *user_data) {
+    if (!propagationParamsValid("propagateDistributionOnCsrGraph", isEmptyCsrGraph(graph) ? 0 : graph.size,
+                                distribution, steps)) {
+        return -1;
+    }
+    // Deux tampons échangés à chaque pas, le résultat est recopié à la fin si besoin
+    double *curr = distribution;
+    double *next = malloc((size_t)graph.size * sizeof *next);
+    if (next == NULL) {
+        perror("propagateDistributionOnCsrGraph: allocation failed");
+        return -1;
+    }
+    double *scratch = next;
+
+    int done = 0;
+    while (done < steps) {
+        memset(next, 0, (size_t)graph.size * sizeof *next);
+        for (int i = 0; i < graph.size; i++) {
+            double mass = curr[i];
+            if (mass == 0.0) continue;
+            for (int e = graph.offsets[i]; e < graph.offsets[i + 1]; e++) {
+                next[graph.targets[e] - 1] += mass * graph.weights[e];
+            }
+        }
+        double *tmp = curr;
+        curr = next;
+        next = tmp;
+        done++;
+        if (callback != NULL && callback(done, curr, graph.size, user_data) != 0) break;
+    }
+    if (curr != distribution) {
+        memcpy(distribution, curr, (size_t)graph.size * sizeof *curr);
+    }
+    free(scratch);
+    return done;
+}
+
+int writeDistributionStep(int step, const double *distribution, int size, void *user_data) {
+    FILE *file = (FILE *)user_data;
+    if (file == NULL) return 1;
+    fprintf(file, "%d", step);
+    for (int i = 0; i < size; i++) {
+        fprintf(file, ",%.17g", distribution[i]);
+    }
+    return (fprintf(file, "\n") < 0) ? 1 : 0;
+}
@@ -0,0 +1,61 @@
+#ifndef PROPAGATION_H
+#define PROPAGATION_H
+
+#include <stdio.h>
+#include "graph.h"
+#include "csr_graph.h"
+
+/**
+ * @file propagation.h
+ * @brief Evolution of a probability distribution, pi(t+1) = pi(t) x P, directly on the graph
+ *
+ * One step visits every edge once: n steps cost O(n x E) instead of the
+ * O(N^3 log n) of a dense matrix power. Distributions are arrays of
+ * graph.size doubles, entry v - 1 holding the probability of vertex v.
+ */
+
+/**
+ * @brief Function called after every step of a propagation
+ * @param step Number of steps done so far (1 for the first step)
+ * @param distribution Distribution after that step (size entries, read only)
+ * @param size Number of vertices
+ * @param user_data Pointer given to the propagation function
+ * @return 0 to continue, non-zero to stop the propagation after this step
+ */
+typedef int (*t_distribution_callback)(int step, const double *distribution, int size, void *user_data);
+
+/**
+ * @brief Applies steps transitions of a graph to a distribution, in place
+ * @param graph The graph (adjacency lists)
+ * @param distribution Initial distribution, replaced by the distribution after the last step
+ * @param steps Number of steps (>= 0)
+ * @param callback Function called after every step, or NULL
+ * @param user_data Pointer passed to callback
+ * @return Number of steps done on success, -1 on error
+ */
+int propagateDistributionOnGraph(t_graph graph, double *distribution, int steps,
+                                 t_distribution_callback callback, void *user_data);
+
+/**
+ * @brief Applies steps transitions of a CSR graph to a distribution, in place
+ * @param graph The CSR graph
+ * @param distribution Initial distribution, replaced by the distribution after the last step
+ * @param steps Number of steps (>= 0)
+ * @param callback Function called after every step, or NULL
+ * @param user_data Pointer passed to callback
+ * @return Number of steps done on success, -1 on error
+ */
+int propagateDistributionOnCsrGraph(t_csr_graph graph, double *distribution, int steps,
+                                    t_distribution_callback callback, void *user_data);
+
+/**
+ * @brief Callback streaming every step as one CSV line "step,p1,p2,...,pN"
+ * @param step Number of steps done so far
+ * @param distribution Distribution after that step
+ * @param size Number of vertices
+ * @param user_data The FILE* to write to
+ * @return 0 on success, 1 on write error (stops the propagation)
+ */
+int writeDistributionStep(int step, const double *distribution, int size, void *user_data);
+
+#endif //PROPAGATION_H
@@ -0,0 +1,524 @@
+#include "scc.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "tarjan.h"
+#include "utils.h"
+
+/**
+ * @file scc.c
+ * @brief Implementation of the multi-threaded SCC engine (trim, forward-backward, coloring).
+ */
+
+#define SCC_UNASSIGNED (-1)
+
+/** Below this many vertices to process, a phase runs on the calling thread only. */
+#define SCC_PARALLEL_MIN_WORK 4096
+
+#define SCC_FORWARD 1
+#define SCC_BACKWARD 2
+
+/* private functions =================================================== */
+
+/**
+ * @brief Shared state of the parallel SCC engine (0-based vertices).
+ * @param out_offsets, out_targets Forward graph (CSR arrays, targets 1-based).
+ * @param in_offsets, in_sources Reverse graph (sources 0-based).
+ * @param component Representative vertex of the SCC of each vertex, or SCC_UNASSIGNED.
+ * @param reached Forward / backward marks of the pivot searches.
+ * @param color Largest vertex id reaching each vertex (coloring step).
+ * @param work Vertices processed by the current phase (frontier, active vertices or roots).
+ * @param next_work Next BFS frontier, filled through next_count.
+ * @param next_item Dynamic scheduling counter of the root searches.
+ * @param failed Set by a thread whose allocation failed: the phase stops and parallelScc() returns NULL.
+ */
+typedef struct s_scc_context {
+    int size;
+    int thread_count;
+    const int *out_offsets;
+    const int *out_targets;
+    int *in_offsets;
+    int *in_sources;
+    int *component;
+    int *in_degree;
+    int *out_degree;
+    atomic_uchar *reached;
+    atomic_int *color;
+    int *work;
+    int work_count;
+    int *next_work;
+    atomic_int next_count;
+    int direction;
+    int sweep;
+    atomic_int changed;
+    atomic_int next_item;
+    atomic_int failed;
+} t_scc_context;
+
+/**
+ * @brief Work of one thread in a phase.
+ * @param queue Private growable queue of the root searches.
+ */
+typedef struct s_scc_task {
+    t_scc_context *ctx;
+    int index;
+    int count;
+    int *queue;
+    int queue_capacity;
+} t_scc_task;
+
+/**
+ * @brief Range [begin, end) of items of a task when count items are split evenly.
+ */
+static void taskRange(const t_scc_task *task, int count, int *begin, int *end) {
+    *begin = (int)((long long)count * task->index / task->count);
+    *end = (int)((long long)count * (task->index + 1) / task->count);
+}
+
+/**
+ * @brief Runs one phase on all tasks; the calling thread runs the first one.
+ *
+ * Phases with less than SCC_PARALLEL_MIN_WORK items run on one thread: long
+ * chains have thousands of tiny BFS levels where starting threads would cost
+ * more than the work.
+ */
+static void runSccPhase(t_scc_task *tasks, int items, void *(*phase)(void *)) {
+    t_scc_context *ctx = tasks[0].ctx;
+    int count = (items < SCC_PARALLEL_MIN_WORK) ? 1 : ctx->thread_count;
+    pthread_t *threads = (count > 1) ? malloc((size_t)count * sizeof *threads) : NULL;
+    int *started = (count > 1) ? calloc((size_t)count, sizeof *started) : NULL;
+    if (threads == NULL || started == NULL) count = 1;
+    for (int t = 0; t < count; t++) tasks[t].count = count;
+    for (int t = 1; t < count; t++) {
+        started[t] = (pthread_create(&threads[t], NULL, phase, &tasks[t]) == 0);
+    }
+    phase(&tasks[0]);
+    for (int t = 1; t < count; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        } else {
+            phase(&tasks[t]);
+        }
+    }
+    free(threads);
+    free(started);
+}
+
+/**
+ * @brief Phase: degrees of every vertex, self loops excluded.
+ */
+static void *computeDegreesPhase(void *arg) {
+    t_scc_task *task = (t_scc_task *)arg;
+    t_scc_context *ctx = task->ctx;
+    int begin, end;
+    taskRange(task, ctx->size, &begin, &end);
+    for (int v = begin; v < end; v++) {
+        int out = 0, in = 0;
+        for (int e = ctx->out_offsets[v]; e < ctx->out_offsets[v + 1]; e++) {
+            if (ctx->out_targets[e] - 1 != v) out++;
+        }
+        for (int e = ctx->in_offsets[v]; e < ctx->in_offsets[v + 1]; e++) {
+            if (ctx->in_sources[e] != v) in++;
+        }
+        ctx->out_degree[v] = out;
+        ctx->in_degree[v] = in;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Phase: one BFS level from the pivot, forward or backward.
+ */
+static void *expandFrontierPhase(void *arg) {
+    t_scc_task *task = (t_scc_task *)arg;
+    t_scc_context *ctx = task->ctx;
+    const int forward = (ctx->direction == SCC_FORWARD);
+    const int *offsets = forward ? ctx->out_offsets : ctx->in_offsets;
+    int begin, end;
+    taskRange(task, ctx->work_count, &begin, &end);
+    for (int i = begin; i < end; i++) {
+        int v = ctx->work[i];
+        for (int e = offsets[v]; e < offsets[v + 1]; e++) {
+            int w = forward ? ctx->out_targets[e] - 1 : ctx->in_sources[e];
+            if (ctx->component[w] != SCC_UNASSIGNED) continue;
+            // Le premier thread qui marque w l'ajoute à la frontière suivante
+            unsigned char previous = atomic_fetch_or(&ctx->reached[w], (unsigned char)ctx->direction);
+            if ((previous & ctx->direction) == 0) {
+                ctx->next_work[atomic_fetch_add(&ctx->next_count, 1)] = w;
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Phase: one propagation round of the largest reaching vertex id.
+ *
+ * Each thread sweeps its range in ctx->sweep order and sees the colors it
+ * has just raised, so a path ordered like the sweep is colored in one round.
+ */
+static void *propagateColorsPhase(void *arg) {
+    t_scc_task *task = (t_scc_task *)arg;
+    t_scc_context *ctx = task->ctx;
+    int begin, end, changed = 0;
+    taskRange(task, ctx->work_count, &begin, &end);
+    for (int k = 0; k < end - begin; k++) {
+        int v = ctx->work[ctx->sweep ? end - 1 - k : begin + k];
+        int c = atomic_load_explicit(&ctx->color[v], memory_order_relaxed);
+        for (int e = ctx->out_offsets[v]; e < ctx->out_offsets[v + 1]; e++) {
+            int w = ctx->out_targets[e] - 1;
+            if (ctx->component[w] != SCC_UNASSIGNED) continue;
+            int current = atomic_load_explicit(&ctx->color[w], memory_order_relaxed);
+            while (current < c) {
+                if (atomic_compare_exchange_weak(&ctx->color[w], &current, c)) {
+                    changed = 1;
+                    break;
+                }
+            }
+        }
+    }
+    if (changed) atomic_store(&ctx->changed, 1);
+    return NULL;
+}
+
+/**
+ * @brief Adds a vertex to the private queue of a task.
+ * @return 1 on success, 0 on allocation failure.
+ */
+static int pushTaskQueue(t_scc_task *task, int *length, int v) {
+    if (*length == task->queue_capacity) {
+        int capacity = task->queue_capacity > 0 ? task->queue_capacity * 2 : 1024;
+        int *queue = realloc(task->queue, (size_t)capacity * sizeof *queue);
+        if (queue == NULL) return 0;
+        task->queue = queue;
+        task->queue_capacity = capacity;
+    }
+    task->queue[(*length)++] = v;
+    return 1;
+}
+
+/**
+ * @brief Phase: for every root r (color[r] == r), the vertices of color r
+ *        reaching r form the SCC of r.
+ *
+ * Roots are handed out dynamically; colors are disjoint, so each vertex is
+ * only ever written by the thread owning its color. An allocation failure
+ * sets ctx->failed, which stops every thread.
+ */
+static void *extractColorComponentsPhase(void *arg) {
+    t_scc_task *task = (t_scc_task *)arg;
+    t_scc_context *ctx = task->ctx;
+    while (!atomic_load_explicit(&ctx->failed, memory_order_relaxed)) {
+        int item = atomic_fetch_add(&ctx->next_item, 1);
+        if (item >= ctx->work_count) break;
+        int root = ctx->work[item];
+        int length = 0, head = 0;
+        ctx->component[root] = root;
+        if (!pushTaskQueue(task, &length, root)) {
+            perror("parallelScc: allocation failed");
+            atomic_store(&ctx->failed, 1);
+            return NULL;
+        }
+        while (head < length) {
+            int v = task->queue[head++];
+            for (int e = ctx->in_offsets[v]; e < ctx->in_offsets[v + 1]; e++) {
+                int u = ctx->in_sources[e];
+                // Couleur d'abord : seul ce thread écrit les sommets de la couleur root
+                if (atomic_load_explicit(&ctx->color[u], memory_order_relaxed) != root) continue;
+                if (ctx->component[u] != SCC_UNASSIGNED) continue;
+                ctx->component[u] = root;
+                if (!pushTaskQueue(task, &length, u)) {
+                    perror("parallelScc: allocation failed");
+                    atomic_store(&ctx->failed, 1);
+                    return NULL;
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Builds the reverse graph (in-edges of every vertex, 0-based sources).
+ * @return 1 on success, -1 on allocation failure.
+ */
+static int buildReverseGraph(t_csr_graph graph, t_scc_context *ctx) {
+    ctx->in_offsets = calloc((size_t)graph.size + 1, sizeof *ctx->in_offsets);
+    ctx->in_sources = malloc(((size_t)graph.edge_count + 1) * sizeof *ctx->in_sources);
+    int *fill = malloc((size_t)graph.size * sizeof *fill);
+    if (ctx->in_offsets == NULL || ctx->in_sources == NULL || fill == NULL) {
+        free(fill);
+        return -1;
+    }
+    for (int e = 0; e < graph.edge_count; e++) ctx->in_offsets[graph.targets[e]]++;
+    for (int v = 0; v < graph.size; v++) {
+        ctx->in_offsets[v + 1] += ctx->in_offsets[v];
+        fill[v] = ctx->in_offsets[v];
+    }
+    for (int v = 0; v < graph.size; v++) {
+        for (int e = graph.offsets[v]; e < graph.offsets[v + 1]; e++) {
+            ctx->in_sources[fill[graph.targets[e] - 1]++] = v;
+        }
+    }
+    free(fill);
+    return 1;
+}
+
+static void freeSccContext(t_scc_context *ctx) {
+    free(ctx->in_offsets);
+    free(ctx->in_sources);
+    free(ctx->component);
+    free(ctx->in_degree);
+    free(ctx->out_degree);
+    free(ctx->reached);
+    free(ctx->color);
+    free(ctx->work);
+    free(ctx->next_work);
+}
+
+/**
+ * @brief Trim: repeatedly removes vertices without remaining in- or out-edges.
+ *
+ * Sequential worklist, O(V + E) in total, on degrees computed in parallel.
+ *
+ * @return Number of trimmed vertices.
+ */
+static int trimSccContext(t_scc_context *ctx, t_scc_task *tasks) {
+    runSccPhase(tasks, ctx->size, computeDegreesPhase);
+    int *queue = ctx->work;
+    int length = 0;
+    for (int v = 0; v < ctx->size; v++) {
+        if (ctx->in_degree[v] == 0 || ctx->out_degree[v] == 0) {
+            ctx->component[v] = v;
+            queue[length++] = v;
+        }
+    }
+    for (int head = 0; head < length; head++) {
+        int v = queue[head];
+        for (int e = ctx->out_offsets[v]; e < ctx->out_offsets[v + 1]; e++) {
+            int w = ctx->out_targets[e] - 1;
+            if (w == v || ctx->component[w] != SCC_UNASSIGNED) continue;
+            if (--ctx->in_degree[w] == 0) {
+                ctx->component[w] = w;
+                queue[length++] = w;
+            }
+        }
+        for (int e = ctx->in_offsets[v]; e < ctx->in_offsets[v + 1]; e++) {
+            int u = ctx->in_sources[e];
+            if (u == v || ctx->component[u] != SCC_UNASSIGNED) continue;
+            if (--ctx->out_degree[u] == 0) {
+                ctx->component[u] = u;
+                queue[length++] = u;
+            }
+        }
+    }
+    return length;
+}
+
+/**
+ * @brief Parallel BFS from the pivot in one direction, marking ctx->reached.
+ */
+static void searchFromPivot(t_scc_context *ctx, t_scc_task *tasks, int pivot, int direction) {
+    ctx->direction = direction;
+    atomic_fetch_or(&ctx->reached[pivot], (unsigned char)direction);
+    ctx->work[0] = pivot;
+    ctx->work_count = 1;
+    while (ctx->work_count > 0) {
+        atomic_store(&ctx->next_count, 0);
+        runSccPhase(tasks, ctx->work_count, expandFrontierPhase);
+        int *tmp = ctx->work;
+        ctx->work = ctx->next_work;
+        ctx->next_work = tmp;
+        ctx->work_count = atomic_load(&ctx->next_count);
+    }
+}
+
+/**
+ * @brief Forward-backward step: the SCC of the best connected remaining vertex.
+ * @return Size of the SCC found (0 if every vertex already has a component).
+ */
+static int forwardBackwardStep(t_scc_context *ctx, t_scc_task *tasks) {
+    int pivot = -1;
+    long long best = -1;
+    for (int v = 0; v < ctx->size; v++) {
+        if (ctx->component[v] != SCC_UNASSIGNED) continue;
+        long long score = (long long)(ctx->in_degree[v] + 1) * (ctx->out_degree[v] + 1);
+        if (score > best) {
+            best = score;
+            pivot = v;
+        }
+    }
+    if (pivot < 0) return 0;
+
+    searchFromPivot(ctx, tasks, pivot, SCC_FORWARD);
+    searchFromPivot(ctx, tasks, pivot, SCC_BACKWARD);
+    int found = 0;
+    for (int v = 0; v < ctx->size; v++) {
+        if (atomic_load_explicit(&ctx->reached[v], memory_order_relaxed) == (SCC_FORWARD | SCC_BACKWARD)) {
+            ctx->component[v] = pivot;
+            found++;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Coloring step, repeated until every vertex has a component.
+ * @return Number of coloring rounds, -1 if a root search failed to allocate its queue.
+ */
+static int coloringSteps(t_scc_context *ctx, t_scc_task *tasks) {
+    int rounds = 0;
+    int *work = ctx->work;
+    int *active = ctx->next_work;
+    int active_count = 0;
+    for (int v = 0; v < ctx->size; v++) {
+        if (ctx->component[v] == SCC_UNASSIGNED) active[active_count++] = v;
+    }
+
+    while (active_count > 0) {
+        rounds++;
+        for (int i = 0; i < active_count; i++) {
+            atomic_store_explicit(&ctx->color[active[i]], active[i], memory_order_relaxed);
+        }
+        // Propagation jusqu'à stabilité, en alternant le sens de parcours
+        ctx->work = active;
+        ctx->work_count = active_count;
+        do {
+            atomic_store(&ctx->changed, 0);
+            runSccPhase(tasks, active_count, propagateColorsPhase);
+            ctx->sweep = !ctx->sweep;
+        } while (atomic_load(&ctx->changed));
+
+        // Une composante par couleur, trouvée depuis le sommet qui a donné la couleur
+        int *roots = ctx->in_degree;
+        int root_count = 0;
+        for (int i = 0; i < active_count; i++) {
+            int v = active[i];
+            if (atomic_load_explicit(&ctx->color[v], memory_order_relaxed) == v) roots[root_count++] = v;
+        }
+        ctx->work = roots;
+        ctx->work_count = root_count;
+        atomic_store(&ctx->next_item, 0);
+        runSccPhase(tasks, root_count, extractColorComponentsPhase);
+        if (atomic_load(&ctx->failed)) {
+            ctx->work = work;
+            return -1;
+        }
+
+        int remaining = 0;
+        for (int i = 0; i < active_count; i++) {
+            if (ctx->component[active[i]] == SCC_UNASSIGNED) active[remaining++] = active[i];
+        }
+        active_count = remaining;
+    }
+    ctx->work = work;
+    return rounds;
+}
+
+/**
+ * @brief Builds the partition: classes numbered by smallest vertex, vertices in increasing order.
+ * @return The partition, or NULL on allocation failure.
+ */
+static t_partition *buildSccPartition(const int *component, int size) {
+    t_partition *partition = createPartition();
+    int *class_of = malloc((size_t)size * sizeof *class_of);
+    if (partition == NULL || class_of == NULL) {
+        free(class_of);
+        if (partition != NULL) freePartition(partition);
+        return NULL;
+    }
+    for (int v = 0; v < size; v++) class_of[v] = 0;
+    int count = 0;
+    for (int v = 0; v < size; v++) {
+        if (class_of[component[v]] == 0) class_of[component[v]] = ++count;
+    }
+
+    t_class **classes = malloc((size_t)count * sizeof *classes);
+    if (classes == NULL) {
+        free(class_of);
+        freePartition(partition);
+        return NULL;
+    }
+    for (int c = 0; c < count; c++) classes[c] = createClass(c + 1);
+    // Ajout en tête : parcours décroissant pour obtenir des listes croissantes
+    for (int v = size - 1; v >= 0; v--) {
+        addVertexToClass(classes[class_of[component[v]] - 1], v + 1);
+    }
+    for (int c = 0; c < count; c++) addClassToPartition(partition, classes[c]);
+    free(classes);
+    free(class_of);
+    return partition;
+}
+
+/**
+ * @brief Body of parallelScc() and parallelSccQuiet().
+ * @param verbose Print the statistics of the three phases when non-zero.
+ */
+static t_partition *runParallelScc(t_csr_graph graph, int thread_count, int verbose) {
+    if (isEmptyCsrGraph(graph) || graph.size <= 0) return createPartition();
+
+    int size = graph.size;
+    t_scc_context ctx = { .size = size, .out_offsets = graph.offsets, .out_targets = graph.targets };
+    ctx.thread_count = resolveThreadCount(thread_count);
+    ctx.component = malloc((size_t)size * sizeof *ctx.component);
+    ctx.in_degree = malloc((size_t)size * sizeof *ctx.in_degree);
+    ctx.out_degree = malloc((size_t)size * sizeof *ctx.out_degree);
+    ctx.reached = calloc((size_t)size, sizeof *ctx.reached);
+    ctx.color = malloc((size_t)size * sizeof *ctx.color);
+    ctx.work = malloc((size_t)size * sizeof *ctx.work);
+    ctx.next_work = malloc((size_t)size * sizeof *ctx.next_work);
+    t_scc_task *tasks = calloc((size_t)ctx.thread_count, sizeof *tasks);
+    if (ctx.component == NULL || ctx.in_degree == NULL || ctx.out_degree == NULL || ctx.reached == NULL ||
+        ctx.color == NULL || ctx.work == NULL || ctx.next_work == NULL || tasks == NULL ||
+        buildReverseGraph(graph, &ctx) < 0) {
+        perror("parallelScc: allocation failed");
+        free(tasks);
+        freeSccContext(&ctx);
+        return NULL;
+    }
+    for (int v = 0; v < size; v++) ctx.component[v] = SCC_UNASSIGNED;
+    for (int t = 0; t < ctx.thread_count; t++) {
+        tasks[t].ctx = &ctx;
+        tasks[t].index = t;
+    }
+
+    int trimmed = trimSccContext(&ctx, tasks);
+    int pivot_size = forwardBackwardStep(&ctx, tasks);
+    int rounds = coloringSteps(&ctx, tasks);
+
+    t_partition *partition = (rounds < 0) ? NULL : buildSccPartition(ctx.component, size);
+    if (partition != NULL && verbose) {
+        printf("Parallel SCC (%d thread(s)): %d trimmed, pivot SCC of %d, %d coloring round(s)\n",
+               ctx.thread_count, trimmed, pivot_size, rounds);
+        printf("Found %d strongly connected component(s)\n\n", partition->class_number);
+    }
+
+    for (int t = 0; t < ctx.thread_count; t++) free(tasks[t].queue);
+    free(tasks);
+    freeSccContext(&ctx);
+    return partition;
+}
+
+/* public functions =================================================== */
+
+t_partition *parallelScc(t_csr_graph graph, int thread_count) {
+    return runParallelScc(graph, thread_count, 1);
+}
+
+t_partition *parallelSccQuiet(t_csr_graph graph, int thread_count) {
+    return runParallelScc(graph, thread_count, 0);
+}
+
+t_partition *computeSccPartition(t_csr_graph graph, t_scc_engine engine, int thread_count) {
+    if (engine == SCC_ENGINE_PARALLEL) return parallelScc(graph, thread_count);
+    return tarjanCsr(graph);
+}
+
+const char *getSccEngineName(t_scc_engine engine) {
+    switch (engine) {
+        case SCC_ENGINE_TARJAN: return "tarjan";
+        case SCC_ENGINE_PARALLEL: return "parallel";
+        default: return "unknown";
+    }
+}
@@ -0,0 +1,71 @@
+#ifndef SCC_H
+#define SCC_H
+
+#include "partition.h"
+#include "csr_graph.h"
+
+/**
+ * @file scc.h
+ * @brief Choice of the strongly connected components engine, and a multi-threaded engine.
+ *
+ * The parallel engine works on a CSR graph and its reverse:
+ * 1. trim: vertices with no incoming or no outgoing edge are their own SCC
+ *    (repeated until none is left, which removes every acyclic part);
+ * 2. forward-backward: the SCC of a well connected pivot is the intersection
+ *    of its forward and backward closures, each found by a parallel BFS;
+ * 3. coloring: every remaining vertex takes the largest vertex id that
+ *    reaches it; each color holds exactly one SCC, found by a backward
+ *    search from the vertex that gave its color. Repeated until every
+ *    vertex has a component.
+ */
+
+/**
+ * @enum e_scc_engine
+ * @brief Algorithm used by computeSccPartition().
+ */
+typedef enum e_scc_engine {
+    SCC_ENGINE_TARJAN,      /**< Sequential iterative Tarjan, tarjanCsr() */
+    SCC_ENGINE_PARALLEL     /**< Multi-threaded trim / forward-backward / coloring, parallelScc() */
+} t_scc_engine;
+
+/**
+ * @brief Computes the strongly connected components of a CSR graph on several threads.
+ *
+ * Classes are numbered 1..k in increasing order of their smallest vertex and
+ * list their vertices in increasing order, so the partition is the same for
+ * any number of threads. It contains the same components as tarjanCsr(),
+ * with other class ids.
+ *
+ * @param graph The CSR graph to analyze.
+ * @param thread_count Number of threads (<= 0: MARKOV_DEFAULT_THREADS, see resolveThreadCount()).
+ * @return Pointer to the partition (empty if the graph is empty), or NULL on
+ *         allocation failure. Caller must free with freePartition().
+ */
+t_partition *parallelScc(t_csr_graph graph, int thread_count);
+
+/**
+ * @brief Same as parallelScc(), without printing anything: for checks run inside other routines.
+ * @param graph The CSR graph to analyze.
+ * @param thread_count Number of threads (<= 0: MARKOV_DEFAULT_THREADS).
+ * @return Pointer to the partition, or NULL on allocation failure. Caller must free with freePartition().
+ */
+t_partition *parallelSccQuiet(t_csr_graph graph, int thread_count);
+
+/**
+ * @brief Computes the strongly connected components of a CSR graph with the chosen engine.
+ * @param graph The CSR graph to analyze.
+ * @param engine SCC_ENGINE_TARJAN or SCC_ENGINE_PARALLEL.
+ * @param thread_count Number of threads of the parallel engine (ignored by Tarjan).
+ * @return Pointer to the partition, or NULL on allocation failure.
+ *         Caller must free with freePartition().
+ */
+t_partition *computeSccPartition(t_csr_graph graph, t_scc_engine engine, int thread_count);
+
+/**
+ * @brief Name of an engine ("tarjan" or "parallel").
+ * @param engine Engine.
+ * @return Static string.
+ */
+const char *getSccEngineName(t_scc_engine engine);
+
+#endif //SCC_H
@@ -0,0 +1,408 @@
+#include "simulation.h"
+#include <limits.h>
+#include <pthread.h>
+#include <string.h>
+#include "utils.h"
+
+/* private functions =================================================== */
+
+/**
+ * @brief Allocates the arrays of a sampler with edge_count columns.
+ * @return 1 on success, -1 on allocation failure (sampler left empty).
+ */
+static int allocateWalkSampler(t_walk_sampler *sampler, int size, int edge_count) {
+    *sampler = createEmptyWalkSampler();
+    size_t columns = (size_t)(edge_count > 0 ? edge_count : 1);
+    sampler->offsets = malloc(((size_t)size + 1) * sizeof(int));
+    sampler->thresholds = malloc(columns * sizeof(double));
+    sampler->targets = malloc(columns * sizeof(int));
+    sampler->aliases = malloc(columns * sizeof(int));
+    if (sampler->offsets == NULL || sampler->thresholds == NULL || sampler->targets == NULL ||
+        sampler->aliases == NULL) {
+        perror("createWalkSampler: allocation failed");
+        freeWalkSampler(sampler);
+        return -1;
+    }
+    sampler->size = size;
+    return 1;
+}
+
+/**
+ * @brief Turns the raw weights of one state into its alias table (Vose's method).
+ *
+ * Each weight is scaled to w x degree / sum: columns below 1 ("small") are
+ * topped up by a column above 1 ("large"), which becomes their alias and
+ * loses the same amount. Every column ends with exactly one alias.
+ *
+ * @param sampler Sampler whose thresholds hold the weights of the row.
+ * @param state State (0-indexed).
+ * @param small Scratch stack of degree entries.
+ * @param large Scratch stack of degree entries.
+ * @return 1 on success, -1 on a negative weight.
+ */
+static int buildAliasRow(t_walk_sampler *sampler, int state, int *small, int *large) {
+    int begin = sampler->offsets[state], degree = sampler->offsets[state + 1] - begin;
+    double *threshold = sampler->thresholds + begin;
+    const int *target = sampler->targets + begin;
+    int *alias = sampler->aliases + begin;
+    double sum = 0.0;
+    for (int k = 0; k < degree; k++) {
+        if (threshold[k] < 0.0) {
+            fprintf(stderr, "createWalkSampler: negative weight on an edge of state %d\n", state + 1);
+            return -1;
+        }
+        sum += threshold[k];
+    }
+    // Aucune transition utilisable : le marcheur reste sur place
+    if (sum <= 0.0) {
+        for (int k = 0; k < degree; k++) {
+            threshold[k] = 1.0;
+            alias[k] = state;
+            sampler->targets[begin + k] = state;
+        }
+        return 1;
+    }
+
+    int small_count = 0, large_count = 0;
+    for (int k = 0; k < degree; k++) {
+        threshold[k] = threshold[k] * degree / sum;
+        alias[k] = target[k];
+        if (threshold[k] < 1.0) small[small_count++] = k;
+        else large[large_count++] = k;
+    }
+    while (small_count > 0 && large_count > 0) {
+        int s = small[--small_count], l = large[large_count - 1];
+        alias[s] = target[l];
+        threshold[l] -= 1.0 - threshold[s];
+        if (threshold[l] < 1.0) {
+            large_count--;
+            small[small_count++] = l;
+        }
+    }
+    // Restes dus aux arrondis : la colonne garde toujours sa propre cible
+    while (large_count > 0) threshold[large[--large_count]] = 1.0;
+    while (small_count > 0) threshold[small[--small_count]] = 1.0;
+    return 1;
+}
+
+/**
+ * @brief Builds the alias table of every state once the raw weights are in place.
+ * @return 1 on success, -1 on error (sampler freed).
+ */
+static int buildAliasTables(t_walk_sampler *sampler) {
+    int max_degree = 1;
+    for (int s = 0; s < sampler->size; s++) {
+        int degree = sampler->offsets[s + 1] - sampler->offsets[s];
+        if (degree > max_degree) max_degree = degree;
+    }
+    int *small = malloc((size_t)max_degree * sizeof(int));
+    int *large = malloc((size_t)max_degree * sizeof(int));
+    int status = (small != NULL && large != NULL) ? 1 : -1;
+    if (status < 0) perror("createWalkSampler: allocation failed");
+    for (int s = 0; s < sampler->size && status == 1; s++) {
+        status = buildAliasRow(sampler, s, small, large);
+    }
+    free(small);
+    free(large);
+    if (status < 0) freeWalkSampler(sampler);
+    return status;
+}
+
+/**
+ * @brief Random numbers of one walker: Philox blocks of counter (block, walker) under key seed.
+ * @param key Seed, split in two 32-bit words
+ * @param counter Block number (words 0-1) and walker id (words 2-3)
+ * @param block Last block drawn
+ * @param used Number of words of block already consumed
+ */
+typedef struct s_walker_stream {
+    uint32_t key[2];
+    uint32_t counter[4];
+    uint32_t block[4];
+    int used;
+} t_walker_stream;
+
+static void initWalkerStream(t_walker_stream *stream, uint64_t seed, long long walker) {
+    stream->key[0] = (uint32_t)seed;
+    stream->key[1] = (uint32_t)(seed >> 32);
+    stream->counter[0] = 0;
+    stream->counter[1] = 0;
+    stream->counter[2] = (uint32_t)(uint64_t)walker;
+    stream->counter[3] = (uint32_t)((uint64_t)walker >> 32);
+    stream->used = 4;
+}
+
+/**
+ * @brief Uniform number in [0, 1) from 53 random bits (two words of the current block).
+ */
+static inline double nextWalkerUniform(t_walker_stream *stream) {
+    if (stream->used == 4) {
+        philox4x32(stream->counter, stream->key, stream->block);
+        if (++stream->counter[0] == 0) stream->counter[1]++;
+        stream->used = 0;
+    }
+    uint64_t bits = ((uint64_t)stream->block[stream->used] << 32) | stream->block[stream->used + 1];
+    stream->used += 2;
+    return (double)(bits >> 11) * 0x1.0p-53;
+}
+
+/**
+ * @brief One step of a walker (states 0-indexed), see sampleWalkStep().
+ */
+static inline int nextWalkState(const t_walk_sampler *sampler, int state, double u) {
+    int begin = sampler->offsets[state], degree = sampler->offsets[state + 1] - begin;
+    if (degree == 0) return state;
+    double x = u * degree;
+    int k = (int)x;
+    if (k >= degree) k = degree - 1;
+    int e = begin + k;
+    return (x - k < sampler->thresholds[e]) ? sampler->targets[e] : sampler->aliases[e];
+}
+
+/**
+ * @brief Range of walkers simulated by one thread, into its own histograms.
+ * @param first First walker id of the range
+ * @param last Walker id after the range
+ * @param occupancy Visits of each state (0-indexed) by this range
+ * @param final_counts Final state counts of this range
+ */
+typedef struct s_walk_task {
+    const t_walk_sampler *sampler;
+    int initial_state;
+    int steps;
+    uint64_t seed;
+    long long first;
+    long long last;
+    long long *occupancy;
+    long long *final_counts;
+} t_walk_task;
+
+/**
+ * @brief Worker: simulates the walkers of a task.
+ */
+static void *runWalkTask(void *arg) {
+    t_walk_task *task = (t_walk_task *)arg;
+    t_walker_stream stream;
+    for (long long w = task->first; w < task->last; w++) {
+        initWalkerStream(&stream, task->seed, w);
+        int state = task->initial_state;
+        for (int t = 0; t < task->steps; t++) {
+            state = nextWalkState(task->sampler, state, nextWalkerUniform(&stream));
+            task->occupancy[state]++;
+        }
+        task->final_counts[state]++;
+    }
+    return NULL;
+}
+
+/* public functions =================================================== */
+
+t_walk_sampler createEmptyWalkSampler(void) {
+    t_walk_sampler sampler = { 0, NULL, NULL, NULL, NULL };
+    return sampler;
+}
+
+int createWalkSampler(t_graph graph, t_walk_sampler *sampler) {
+    if (sampler == NULL || graph.values == NULL || graph.size <= 0) {
+        fprintf(stderr, "createWalkSampler: invalid parameters\n");
+        return -1;
+    }
+    int edge_count = 0;
+    for (int s = 0; s < graph.size; s++) {
+        for (t_cell *c = graph.values[s].head; c != NULL; c = c->next) edge_count++;
+    }
+    if (allocateWalkSampler(sampler, graph.size, edge_count) < 0) return -1;
+
+    // Poids bruts dans thresholds, transformés ensuite en tables d'alias
+    int e = 0;
+    for (int s = 0; s < graph.size; s++) {
+        sampler->offsets[s] = e;
+        for (t_cell *c = graph.values[s].head; c != NULL; c = c->next, e++) {
+            if (c->vertex < 1 || c->vertex > graph.size) {
+                fprintf(stderr, "createWalkSampler: edge %d -> %d out of range\n", s + 1, c->vertex);
+                freeWalkSampler(sampler);
+                return -1;
+            }
+            sampler->targets[e] = c->vertex - 1;
+            sampler->thresholds[e] = c->weight;
+        }
+    }
+    sampler->offsets[graph.size] = e;
+    return buildAliasTables(sampler);
+}
+
+int createWalkSamplerFromCsr(t_csr_graph graph, t_walk_sampler *sampler) {
+    if (sampler == NULL || isEmptyCsrGraph(graph)) {
+        fprintf(stderr, "createWalkSamplerFromCsr: invalid parameters\n");
+        return -1;
+    }
+    if (allocateWalkSampler(sampler, graph.size, graph.edge_count) < 0) return -1;
+    memcpy(sampler->offsets, graph.offsets, ((size_t)graph.size + 1) * sizeof(int));
+    for (int e = 0; e < graph.edge_count; e++) {
+        if (graph.targets[e] < 1 || graph.targets[e] > graph.size) {
+            fprintf(stderr, "createWalkSamplerFromCsr: edge target %d out of range\n", graph.targets[e]);
+            freeWalkSampler(sampler);
+            return -1;
+        }
+        sampler->targets[e] = graph.targets[e] - 1;
+        sampler->thresholds[e] = graph.weights[e];
+    }
+    return buildAliasTables(sampler);
+}
+
+int sampleWalkStep(const t_walk_sampler *sampler, int state, double u) {
+    return nextWalkState(sampler, state - 1, u) + 1;
+}
+
+void freeWalkSampler(t_walk_sampler *sampler) {
+    if (sampler == NULL) return;
+    free(sampler->offsets);
+    free(sampler->thresholds);
+    free(sampler->targets);
+    free(sampler->aliases);
+    *sampler = createEmptyWalkSampler();
+}
+
+t_simulation createEmptySimulation(void) {
+    t_simulation simulation = { 0, 0, 0, NULL, NULL };
+    return simulation;
+}
+
+void philox4x32(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4]) {
+    uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+    uint32_t k0 = key[0], k1 = key[1];
+    for (int round = 0; round < 10; round++) {
+        uint64_t p0 = (uint64_t)0xD2511F53u * c0;
+        uint64_t p1 = (uint64_t)0xCD9E8D57u * c2;
+        uint32_t n0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        uint32_t n2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c1 = (uint32_t)p1;
+        c3 = (uint32_t)p0;
+        c0 = n0;
+        c2 = n2;
+        k0 += 0x9E3779B9u;
+        k1 += 0xBB67AE85u;
+    }
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+long long getMaxSimulationWalkers(int steps) {
+    return LLONG_MAX / maxInt(steps, 1);
+}
+
+int simulateRandomWalks(const t_walk_sampler *sampler, int initial_state, long long walkers, int steps,
+                        uint64_t seed, t_simulation *result) {
+    return simulateRandomWalksParallel(sampler, initial_state, walkers, steps, seed, 1, result);
+}
+
+int simulateRandomWalksParallel(const t_walk_sampler *sampler, int initial_state, long long walkers, int steps,
+                                uint64_t seed, int thread_count, t_simulation *result) {
+    if (sampler == NULL || sampler->offsets == NULL || result == NULL || initial_state < 1 ||
+        initial_state > sampler->size || walkers <= 0 || steps < 0 || walkers > getMaxSimulationWalkers(steps)) {
+        fprintf(stderr, "simulateRandomWalks: invalid parameters\n");
+        return -1;
+    }
+    int workers = resolveThreadCount(thread_count);
+    if (walkers < workers) workers = (int)walkers;
+    t_simulation simulation = createEmptySimulation();
+    simulation.size = sampler->size;
+    simulation.walkers = walkers;
+    simulation.steps = steps;
+    simulation.occupancy = calloc((size_t)sampler->size, sizeof(long long));
+    simulation.final_counts = calloc((size_t)sampler->size, sizeof(long long));
+    t_walk_task *tasks = calloc((size_t)workers, sizeof *tasks);
+    pthread_t *threads = malloc((size_t)workers * sizeof *threads);
+    int *started = calloc((size_t)workers, sizeof *started);
+    int ok = simulation.occupancy != NULL && simulation.final_counts != NULL && tasks != NULL &&
+             threads != NULL && started != NULL;
+
+    // Tranche contiguë de marcheurs par thread ; le thread appelant écrit directement dans le résultat.
+    // Les bornes sont calculées sans le produit walkers x t, qui déborderait
+    long long share = walkers / workers, extra = walkers % workers;
+    for (int t = 0; ok && t < workers; t++) {
+        tasks[t].sampler = sampler;
+        tasks[t].initial_state = initial_state - 1;
+        tasks[t].steps = steps;
+        tasks[t].seed = seed;
+        tasks[t].first = share * t + minLongLong(t, extra);
+        tasks[t].last = share * (t + 1) + minLongLong(t + 1, extra);
+        if (t == 0) {
+            tasks[t].occupancy = simulation.occupancy;
+            tasks[t].final_counts = simulation.final_counts;
+        } else {
+            tasks[t].occupancy = calloc((size_t)sampler->size, sizeof(long long));
+            tasks[t].final_counts = calloc((size_t)sampler->size, sizeof(long long));
+            ok = tasks[t].occupancy != NULL && tasks[t].final_counts != NULL;
+        }
+    }
+    if (!ok) perror("simulateRandomWalks: allocation failed");
+
+    for (int t = 1; ok && t < workers; t++) {
+        started[t] = (pthread_create(&threads[t], NULL, runWalkTask, &tasks[t]) == 0);
+    }
+    if (ok) runWalkTask(&tasks[0]);
+    for (int t = 1; ok && t < workers; t++) {
+        // Thread non démarré : sa tranche est simulée ici, le résultat ne change pas
+        if (started[t]) pthread_join(threads[t], NULL);
+        else runWalkTask(&tasks[t]);
+    }
+
+    // Fusion des histogrammes privés, hors de la boucle chaude
+    for (int t = 1; tasks != NULL && t < workers; t++) {
+        for (int s = 0; ok && s < sampler->size; s++) {
+            simulation.occupancy[s] += tasks[t].occupancy[s];
+            simulation.final_counts[s] += tasks[t].final_counts[s];
+        }
+        free(tasks[t].occupancy);
+        free(tasks[t].final_counts);
+    }
+    free(tasks);
+    free(threads);
+    free(started);
+    if (!ok) {
+        freeSimulation(&simulation);
+        return -1;
+    }
+    *result = simulation;
+    return 1;
+}
+
+double getSimulatedDistribution(t_simulation simulation, int state) {
+    if (simulation.final_counts == NULL || state < 1 || state > simulation.size) {
+        fprintf(stderr, "getSimulatedDistribution: invalid state %d\n", state);
+        return -1.0;
+    }
+    return (double)simulation.final_counts[state - 1] / (double)simulation.walkers;
+}
+
+double getSimulatedOccupancy(t_simulation simulation, int state) {
+    if (simulation.occupancy == NULL || state < 1 || state > simulation.size || simulation.steps == 0) {
+        fprintf(stderr, "getSimulatedOccupancy: invalid state %d or no step\n", state);
+        return -1.0;
+    }
+    return (double)simulation.occupancy[state - 1] / ((double)simulation.walkers * simulation.steps);
+}
+
+void displaySimulation(t_simulation simulation) {
+    if (simulation.final_counts == NULL) {
+        printf("No simulation result.\n");
+        return;
+    }
+    printf("%lld walker(s) x %d step(s)\n", simulation.walkers, simulation.steps);
+    for (int s = 1; s <= simulation.size; s++) {
+        if (simulation.final_counts[s - 1] == 0 && simulation.occupancy[s - 1] == 0) continue;
+        printf("  State %d : %.4f after %d steps", s, getSimulatedDistribution(simulation, s), simulation.steps);
+        if (simulation.steps > 0) printf(" | %.4f of the time", getSimulatedOccupancy(simulation, s));
+        printf("\n");
+    }
+}
+
+void freeSimulation(t_simulation *simulation) {
+    if (simulation == NULL) return;
+    free(simulation->occupancy);
+    free(simulation->final_counts);
+    *simulation = createEmptySimulation();
+}
@@ -0,0 +1,194 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <stdint.h>
+#include "graph.h"
+#include "csr_graph.h"
+
+/**
+ * @file simulation.h
+ * @brief Monte Carlo random walks on a Markov graph, with Walker alias tables.
+ *
+ * Every state gets an alias table built once in O(degree) (Vose's method):
+ * its outgoing edges become degree columns of equal probability, each
+ * holding a threshold, the edge target and an alias target. One step draws
+ * a single uniform number: its integer part picks the column, its
+ * fractional part is compared with the threshold, so sampling is O(1)
+ * whatever the degree. The weights of a state are normalized by their sum.
+ *
+ * Random numbers come from the counter-based generator Philox4x32-10: the
+ * n-th number of walker w is a pure function of (seed, w, n), with no state
+ * shared between walkers. Walkers can thus be spread over any number of
+ * threads and the histograms are bit-identical.
+ */
+
+/** Default number of trajectories of the command line simulation. */
+#define SIMULATION_DEFAULT_WALKERS 100000
+
+/**
+ * @brief Alias tables of all the states, stored like a CSR graph.
+ * @param size Number of states
+ * @param offsets Array of size + 1 entries: the columns of state s (0-indexed)
+ *        are [offsets[s], offsets[s + 1])
+ * @param thresholds Probability of keeping the column's own target
+ * @param targets Own target of each column (0-indexed)
+ * @param aliases Alias target of each column (0-indexed)
+ * @note A state without outgoing edge (or whose weights sum to 0) has no
+ *       column and keeps the walker forever.
+ */
+typedef struct s_walk_sampler {
+    int size;
+    int *offsets;
+    double *thresholds;
+    int *targets;
+    int *aliases;
+} t_walk_sampler;
+
+/**
+ * @brief Occupancy histograms of a simulation.
+ * @param size Number of states
+ * @param walkers Number of trajectories
+ * @param steps Number of steps of each trajectory
+ * @param occupancy Number of visits of each state (index state - 1) over steps 1..steps of all trajectories
+ * @param final_counts Number of trajectories ending in each state (index state - 1)
+ */
+typedef struct s_simulation {
+    int size;
+    long long walkers;
+    int steps;
+    long long *occupancy;
+    long long *final_counts;
+} t_simulation;
+
+/**
+ * @brief Creates an empty sampler (NULL arrays).
+ * @return The empty sampler.
+ */
+t_walk_sampler createEmptyWalkSampler(void);
+
+/**
+ * @brief Builds the alias tables of a graph, in O(V + E).
+ * @param graph The graph (non-negative weights).
+ * @param sampler Receives the tables, to free with freeWalkSampler().
+ * @return 1 on success, -1 on error (allocation failure, negative weight).
+ */
+int createWalkSampler(t_graph graph, t_walk_sampler *sampler);
+
+/**
+ * @brief Same as createWalkSampler(), reading a CSR graph.
+ * @param graph The CSR graph (non-negative weights).
+ * @param sampler Receives the tables, to free with freeWalkSampler().
+ * @return 1 on success, -1 on error.
+ */
+int createWalkSamplerFromCsr(t_csr_graph graph, t_walk_sampler *sampler);
+
+/**
+ * @brief Next state of a walker, from one uniform number.
+ * @param sampler The alias tables.
+ * @param state Current state (1-indexed, not checked).
+ * @param u Uniform number in [0, 1).
+ * @return The next state (1-indexed).
+ */
+int sampleWalkStep(const t_walk_sampler *sampler, int state, double u);
+
+/**
+ * @brief Frees the alias tables and resets the sampler to empty.
+ * @param sampler Pointer to the sampler.
+ */
+void freeWalkSampler(t_walk_sampler *sampler);
+
+/**
+ * @brief Creates an empty simulation result (NULL arrays).
+ * @return The empty result.
+ */
+t_simulation createEmptySimulation(void);
+
+/**
+ * @brief Philox4x32-10 block: four random 32-bit words from a counter and a key.
+ *
+ * Ten rounds of two 32 x 32 -> 64-bit multiplications, with a Weyl sequence
+ * of round keys (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3").
+ *
+ * @param counter 128-bit counter.
+ * @param key 64-bit key.
+ * @param out Receives the four words.
+ */
+void philox4x32(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4]);
+
+/**
+ * @brief Largest number of trajectories whose walkers x steps visits fit in the occupancy counters.
+ * @param steps Number of steps of each trajectory (>= 0).
+ * @return LLONG_MAX / max(steps, 1).
+ */
+long long getMaxSimulationWalkers(int steps);
+
+/**
+ * @brief Runs independent random walks from the same state and counts where they go.
+ *
+ * Costs O(walkers x steps) samplings on the calling thread. Walker w draws
+ * its numbers from Philox with key seed and counter (block, w): the same
+ * seed gives the same histograms, identical to simulateRandomWalksParallel().
+ *
+ * @param sampler The alias tables.
+ * @param initial_state Start state of every walker (1-indexed).
+ * @param walkers Number of trajectories (1..getMaxSimulationWalkers(steps)).
+ * @param steps Number of steps of each trajectory (>= 0).
+ * @param seed Seed of the random numbers.
+ * @param result Receives the histograms, to free with freeSimulation().
+ * @return 1 on success, -1 on error.
+ */
+int simulateRandomWalks(const t_walk_sampler *sampler, int initial_state, long long walkers, int steps,
+                        uint64_t seed, t_simulation *result);
+
+/**
+ * @brief Same as simulateRandomWalks(), with the walkers split over several threads.
+ *
+ * Each thread runs a contiguous range of walkers into its own histograms,
+ * without any lock; they are summed at the end. Counts are integers, so the
+ * result is bit-identical whatever the number of threads.
+ * Memory: 2 x size counters per thread.
+ *
+ * @param sampler The alias tables (shared, read only).
+ * @param initial_state Start state of every walker (1-indexed).
+ * @param walkers Number of trajectories (1..getMaxSimulationWalkers(steps)).
+ * @param steps Number of steps of each trajectory (>= 0).
+ * @param seed Seed of the random numbers.
+ * @param thread_count Number of threads (<= 0: MARKOV_DEFAULT_THREADS, see resolveThreadCount()).
+ * @param result Receives the histograms, to free with freeSimulation().
+ * @return 1 on success, -1 on error.
+ */
+int simulateRandomWalksParallel(const t_walk_sampler *sampler, int initial_state, long long walkers, int steps,
+                                uint64_t seed, int thread_count, t_simulation *result);
+
+/**
+ * @brief Empirical probability of being in a state after the last step.
+ * @param simulation The result of simulateRandomWalks().
+ * @param state State (1-indexed).
+ * @return final_counts / walkers, -1 on invalid parameters.
+ */
+double getSimulatedDistribution(t_simulation simulation, int state);
+
+/**
+ * @brief Empirical fraction of the time spent in a state over steps 1..steps.
+ *
+ * For long walks in an irreducible class, this tends to the stationary distribution.
+ *
+ * @param simulation The result of simulateRandomWalks().
+ * @param state State (1-indexed).
+ * @return occupancy / (walkers x steps), -1 on invalid parameters or without steps.
+ */
+double getSimulatedOccupancy(t_simulation simulation, int state);
+
+/**
+ * @brief Displays the final distribution and the occupancy of every visited state.
+ * @param simulation The result of simulateRandomWalks().
+ */
+void displaySimulation(t_simulation simulation);
+
+/**
+ * @brief Frees a simulation result and resets it to empty.
+ * @param simulation Pointer to the result.
+ */
+void freeSimulation(t_simulation *simulation);
+
+#endif //SIMULATION_H
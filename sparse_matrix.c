@@ -0,0 +1,499 @@
+#include "sparse_matrix.h"
+#include <limits.h>
+#include <string.h>
+#include "utils.h"
+
+/**
+ * @file sparse_matrix.c
+ * @brief Implementation of sparse matrices and their products.
+ */
+
+/* private functions =================================================== */
+
+/**
+ * @brief One entry of a row, used to sort a row by column.
+ */
+typedef struct s_sparse_entry {
+    int col;
+    double value;
+} t_sparse_entry;
+
+static int compareSparseEntries(const void *a, const void *b) {
+    int ca = ((const t_sparse_entry *)a)->col;
+    int cb = ((const t_sparse_entry *)b)->col;
+    return (ca > cb) - (ca < cb);
+}
+
+static int compareInts(const void *a, const void *b) {
+    int ia = *(const int *)a;
+    int ib = *(const int *)b;
+    return (ia > ib) - (ia < ib);
+}
+
+/**
+ * @brief Allocate the arrays of a sparse matrix.
+ * @param rows Number of rows.
+ * @param cols Number of columns.
+ * @param nnz Number of entries.
+ * @return The allocated matrix (row_offsets zeroed), or an empty matrix on failure.
+ */
+static t_sparse_matrix allocateSparseMatrix(int rows, int cols, int nnz) {
+    t_sparse_matrix m = createEmptySparseMatrix();
+    m.row_offsets = calloc((size_t)rows + 1, sizeof *m.row_offsets);
+    // malloc(0) may return NULL: always allocate at least one entry
+    m.col_indices = malloc(((size_t)nnz + 1) * sizeof *m.col_indices);
+    m.values = malloc(((size_t)nnz + 1) * sizeof *m.values);
+    if (m.row_offsets == NULL || m.col_indices == NULL || m.values == NULL) {
+        perror("allocateSparseMatrix: allocation failed");
+        freeSparseMatrix(&m);
+        return createEmptySparseMatrix();
+    }
+    m.rows = rows;
+    m.cols = cols;
+    m.nnz = nnz;
+    return m;
+}
+
+/**
+ * @brief Sort the entries of every row by column.
+ * @param m Sparse matrix whose rows are filled but not sorted.
+ * @param entries Scratch array of at least (largest row length) entries.
+ */
+static void sortSparseRows(t_sparse_matrix m, t_sparse_entry *entries) {
+    for (int i = 0; i < m.rows; i++) {
+        int begin = m.row_offsets[i], count = m.row_offsets[i + 1] - begin;
+        if (count < 2) continue;
+        for (int e = 0; e < count; e++) {
+            entries[e].col = m.col_indices[begin + e];
+            entries[e].value = m.values[begin + e];
+        }
+        qsort(entries, (size_t)count, sizeof *entries, compareSparseEntries);
+        for (int e = 0; e < count; e++) {
+            m.col_indices[begin + e] = entries[e].col;
+            m.values[begin + e] = entries[e].value;
+        }
+    }
+}
+
+/**
+ * @brief Largest number of entries in a row.
+ */
+static int maxSparseRowLength(t_sparse_matrix m) {
+    int longest = 0;
+    for (int i = 0; i < m.rows; i++) {
+        longest = maxInt(longest, m.row_offsets[i + 1] - m.row_offsets[i]);
+    }
+    return longest;
+}
+
+/* public functions =================================================== */
+
+t_sparse_matrix createEmptySparseMatrix(void) {
+    t_sparse_matrix m = { .rows = 0, .cols = 0, .nnz = 0, .row_offsets = NULL, .col_indices = NULL, .values = NULL };
+    return m;
+}
+
+int isEmptySparseMatrix(t_sparse_matrix m) {
+    return m.row_offsets == NULL;
+}
+
+void freeSparseMatrix(t_sparse_matrix *m) {
+    if (m == NULL) return;
+    free(m->row_offsets);
+    free(m->col_indices);
+    free(m->values);
+    *m = createEmptySparseMatrix();
+}
+
+int createSparseMatrixFromCsrGraph(t_csr_graph g, t_sparse_matrix *result) {
+    if (result == NULL) {
+        fprintf(stderr, "createSparseMatrixFromCsrGraph: no result matrix provided\n");
+        return -1;
+    }
+    if (isEmptyCsrGraph(g)) {
+        fprintf(stderr, "createSparseMatrixFromCsrGraph: graph is not initialized\n");
+        return -1;
+    }
+
+    *result = allocateSparseMatrix(g.size, g.size, g.edge_count);
+    int *position = malloc((size_t)g.size * sizeof *position);
+    if (isEmptySparseMatrix(*result) || position == NULL) {
+        fprintf(stderr, "createSparseMatrixFromCsrGraph: allocation failed\n");
+        free(position);
+        freeSparseMatrix(result);
+        return -1;
+    }
+    for (int j = 0; j < g.size; j++) position[j] = -1;
+
+    // Une arête en double s'ajoute à la précédente, comme dans la matrice dense
+    int nnz = 0;
+    for (int i = 0; i < g.size; i++) {
+        int row_begin = nnz;
+        for (int e = g.offsets[i]; e < g.offsets[i + 1]; e++) {
+            int col = g.targets[e] - 1;
+            if (position[col] >= row_begin) {
+                result->values[position[col]] += g.weights[e];
+            } else {
+                position[col] = nnz;
+                result->col_indices[nnz] = col;
+                result->values[nnz] = g.weights[e];
+                nnz++;
+            }
+        }
+        result->row_offsets[i + 1] = nnz;
+    }
+    result->nnz = nnz;
+    free(position);
+
+    t_sparse_entry *entries = malloc(((size_t)maxSparseRowLength(*result) + 1) * sizeof *entries);
+    if (entries == NULL) {
+        perror("createSparseMatrixFromCsrGraph: allocation failed");
+        freeSparseMatrix(result);
+        return -1;
+    }
+    sortSparseRows(*result, entries);
+    free(entries);
+    return 1;
+}
+
+int createSparseMatrixFromGraph(t_graph g, t_sparse_matrix *result) {
+    if (result == NULL) {
+        fprintf(stderr, "createSparseMatrixFromGraph: no result matrix provided\n");
+        return -1;
+    }
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    if (isEmptyCsrGraph(csr)) {
+        fprintf(stderr, "createSparseMatrixFromGraph: failed to freeze the graph\n");
+        return -1;
+    }
+    int status = createSparseMatrixFromCsrGraph(csr, result);
+    freeCsrGraph(&csr);
+    return status;
+}
+
+int createSparseMatrixFromMatrix(t_matrix m, t_sparse_matrix *result) {
+    if (!isValidMatrix(m) || result == NULL) {
+        fprintf(stderr, "createSparseMatrixFromMatrix: invalid parameters\n");
+        return -1;
+    }
+    int nnz = 0;
+    for (int i = 0; i < m.rows; i++) {
+        for (int j = 0; j < m.cols; j++) {
+            if (m.data[i][j] != 0.0) nnz++;
+        }
+    }
+    *result = allocateSparseMatrix(m.rows, m.cols, nnz);
+    if (isEmptySparseMatrix(*result)) return -1;
+    int pos = 0;
+    for (int i = 0; i < m.rows; i++) {
+        for (int j = 0; j < m.cols; j++) {
+            if (m.data[i][j] == 0.0) continue;
+            result->col_indices[pos] = j;
+            result->values[pos] = m.data[i][j];
+            pos++;
+        }
+        result->row_offsets[i + 1] = pos;
+    }
+    return 1;
+}
+
+int sparseToDenseMatrix(t_sparse_matrix m, t_matrix *result) {
+    if (isEmptySparseMatrix(m) || result == NULL) {
+        fprintf(stderr, "sparseToDenseMatrix: invalid parameters\n");
+        return -1;
+    }
+    *result = createMatrix(m.rows, m.cols);
+    if (!isValidMatrix(*result)) return -1;
+    for (int i = 0; i < m.rows; i++) {
+        for (int e = m.row_offsets[i]; e < m.row_offsets[i + 1]; e++) {
+            result->data[i][m.col_indices[e]] = m.values[e];
+        }
+    }
+    return 1;
+}
+
+int transposeSparseMatrix(t_sparse_matrix m, t_sparse_matrix *result) {
+    if (isEmptySparseMatrix(m) || result == NULL) {
+        fprintf(stderr, "transposeSparseMatrix: invalid parameters\n");
+        return -1;
+    }
+    *result = allocateSparseMatrix(m.cols, m.rows, m.nnz);
+    int *fill = malloc(((size_t)m.cols + 1) * sizeof *fill);
+    if (isEmptySparseMatrix(*result) || fill == NULL) {
+        perror("transposeSparseMatrix: allocation failed");
+        free(fill);
+        freeSparseMatrix(result);
+        return -1;
+    }
+
+    // Compter les entrées de chaque colonne, puis les répartir ligne par ligne :
+    // les lignes étant parcourues dans l'ordre, chaque ligne du résultat est triée
+    for (int e = 0; e < m.nnz; e++) {
+        result->row_offsets[m.col_indices[e] + 1]++;
+    }
+    for (int j = 0; j < m.cols; j++) {
+        result->row_offsets[j + 1] += result->row_offsets[j];
+        fill[j] = result->row_offsets[j];
+    }
+    for (int i = 0; i < m.rows; i++) {
+        for (int e = m.row_offsets[i]; e < m.row_offsets[i + 1]; e++) {
+            int pos = fill[m.col_indices[e]]++;
+            result->col_indices[pos] = i;
+            result->values[pos] = m.values[e];
+        }
+    }
+    free(fill);
+    return 1;
+}
+
+int multiplySparseMatrixVector(t_sparse_matrix a, const double *x, double *y) {
+    if (isEmptySparseMatrix(a) || x == NULL || y == NULL || x == y) {
+        fprintf(stderr, "multiplySparseMatrixVector: invalid parameters\n");
+        return -1;
+    }
+    for (int i = 0; i < a.rows; i++) {
+        double sum = 0.0;
+        for (int e = a.row_offsets[i]; e < a.row_offsets[i + 1]; e++) {
+            sum += a.values[e] * x[a.col_indices[e]];
+        }
+        y[i] = sum;
+    }
+    return 1;
+}
+
+int multiplyVectorSparseMatrix(const double *x, t_sparse_matrix a, double *y) {
+    if (isEmptySparseMatrix(a) || x == NULL || y == NULL || x == y) {
+        fprintf(stderr, "multiplyVectorSparseMatrix: invalid parameters\n");
+        return -1;
+    }
+    memset(y, 0, (size_t)a.cols * sizeof *y);
+    for (int i = 0; i < a.rows; i++) {
+        double xi = x[i];
+        if (xi == 0.0) continue;
+        for (int e = a.row_offsets[i]; e < a.row_offsets[i + 1]; e++) {
+            y[a.col_indices[e]] += xi * a.values[e];
+        }
+    }
+    return 1;
+}
+
+int multiplySparseDenseMatrices(t_sparse_matrix a, t_matrix b, t_matrix *result) {
+    if (isEmptySparseMatrix(a) || !isValidMatrix(b) || result == NULL) {
+        fprintf(stderr, "multiplySparseDenseMatrices: invalid parameters\n");
+        return -1;
+    }
+    if (a.cols != b.rows) {
+        fprintf(stderr, "multiplySparseDenseMatrices: incompatible dimensions (A:%dx%d vs B:%dx%d)\n",
+                a.rows, a.cols, b.rows, b.cols);
+        return -1;
+    }
+    *result = createMatrix(a.rows, b.cols);
+    if (!isValidMatrix(*result)) return -1;
+
+    // Ligne i du résultat = somme des lignes k de B pondérées par A[i][k]
+    for (int i = 0; i < a.rows; i++) {
+        double *result_row = getMatrixRow(*result, i);
+        for (int e = a.row_offsets[i]; e < a.row_offsets[i + 1]; e++) {
+            const double *b_row = getMatrixRow(b, a.col_indices[e]);
+            double v = a.values[e];
+            for (int j = 0; j < b.cols; j++) {
+                result_row[j] += v * b_row[j];
+            }
+        }
+    }
+    return 1;
+}
+
+int multiplySparseMatrices(t_sparse_matrix a, t_sparse_matrix b, t_sparse_matrix *result) {
+    if (isEmptySparseMatrix(a) || isEmptySparseMatrix(b) || result == NULL) {
+        fprintf(stderr, "multiplySparseMatrices: invalid parameters\n");
+        return -1;
+    }
+    if (a.cols != b.rows) {
+        fprintf(stderr, "multiplySparseMatrices: incompatible dimensions (A:%dx%d vs B:%dx%d)\n",
+                a.rows, a.cols, b.rows, b.cols);
+        return -1;
+    }
+
+    // marker[j] = dernière ligne du résultat où la colonne j est apparue
+    int *marker = malloc((size_t)b.cols * sizeof *marker);
+    double *accumulator = calloc((size_t)b.cols, sizeof *accumulator);
+    int *row_offsets = calloc((size_t)a.rows + 1, sizeof *row_offsets);
+    if (marker == NULL || accumulator == NULL || row_offsets == NULL) {
+        perror("multiplySparseMatrices: allocation failed");
+        free(marker);
+        free(accumulator);
+        free(row_offsets);
+        return -1;
+    }
+
+    // Passe symbolique : nombre d'entrées de chaque ligne du résultat
+    for (int j = 0; j < b.cols; j++) marker[j] = -1;
+    long long nnz = 0;
+    for (int i = 0; i < a.rows; i++) {
+        for (int e = a.row_offsets[i]; e < a.row_offsets[i + 1]; e++) {
+            int k = a.col_indices[e];
+            for (int f = b.row_offsets[k]; f < b.row_offsets[k + 1]; f++) {
+                if (marker[b.col_indices[f]] != i) {
+                    marker[b.col_indices[f]] = i;
+                    nnz++;
+                }
+            }
+        }
+        if (nnz > INT_MAX) {
+            fprintf(stderr, "multiplySparseMatrices: result has too many entries\n");
+            free(marker);
+            free(accumulator);
+            free(row_offsets);
+            return -1;
+        }
+        row_offsets[i + 1] = (int)nnz;
+    }
+
+    *result = allocateSparseMatrix(a.rows, b.cols, (int)nnz);
+    if (isEmptySparseMatrix(*result)) {
+        free(marker);
+        free(accumulator);
+        free(row_offsets);
+        return -1;
+    }
+    free(result->row_offsets);
+    result->row_offsets = row_offsets;
+
+    // Passe numérique : accumulation dense de la ligne, puis colonnes triées
+    for (int j = 0; j < b.cols; j++) marker[j] = -1;
+    for (int i = 0; i < a.rows; i++) {
+        int pos = row_offsets[i];
+        for (int e = a.row_offsets[i]; e < a.row_offsets[i + 1]; e++) {
+            int k = a.col_indices[e];
+            double v = a.values[e];
+            for (int f = b.row_offsets[k]; f < b.row_offsets[k + 1]; f++) {
+                int j = b.col_indices[f];
+                if (marker[j] != i) {
+                    marker[j] = i;
+                    result->col_indices[pos++] = j;
+                }
+                accumulator[j] += v * b.values[f];
+            }
+        }
+        int begin = row_offsets[i];
+        qsort(result->col_indices + begin, (size_t)(pos - begin), sizeof(int), compareInts);
+        for (int e = begin; e < pos; e++) {
+            int j = result->col_indices[e];
+            result->values[e] = accumulator[j];
+            accumulator[j] = 0.0;
+        }
+    }
+
+    free(marker);
+    free(accumulator);
+    return 1;
+}
+
+t_sparse_matrix buildSparseSubMatrix(t_sparse_matrix matrix, t_partition part, int class_id) {
+    if (isEmptySparseMatrix(matrix) || matrix.rows != matrix.cols) {
+        fprintf(stderr, "buildSparseSubMatrix: invalid input matrix\n");
+        return createEmptySparseMatrix();
+    }
+    t_class *curr_class = part.classes;
+    while (curr_class != NULL && curr_class->id != class_id) {
+        curr_class = curr_class->next;
+    }
+    if (curr_class == NULL) {
+        fprintf(stderr, "buildSparseSubMatrix: class_id %d not found in partition\n", class_id);
+        return createEmptySparseMatrix();
+    }
+
+    // local[v] = indice du sommet v dans la classe, -1 s'il n'en fait pas partie
+    int size = curr_class->vertex_number;
+    int *local = malloc((size_t)matrix.rows * sizeof *local);
+    int *vertices = malloc((size_t)size * sizeof *vertices);
+    if (local == NULL || vertices == NULL) {
+        perror("buildSparseSubMatrix: allocation failed");
+        free(local);
+        free(vertices);
+        return createEmptySparseMatrix();
+    }
+    for (int v = 0; v < matrix.rows; v++) local[v] = -1;
+    int index = 0;
+    for (t_vertex *v = curr_class->vertices; v != NULL && index < size; v = v->next) {
+        local[v->value - 1] = index;
+        vertices[index++] = v->value - 1;
+    }
+
+    int nnz = 0;
+    for (int i = 0; i < size; i++) {
+        for (int e = matrix.row_offsets[vertices[i]]; e < matrix.row_offsets[vertices[i] + 1]; e++) {
+            if (local[matrix.col_indices[e]] >= 0) nnz++;
+        }
+    }
+
+    t_sparse_matrix sub = allocateSparseMatrix(size, size, nnz);
+    t_sparse_entry *entries = malloc(((size_t)maxSparseRowLength(matrix) + 1) * sizeof *entries);
+    if (!isEmptySparseMatrix(sub) && entries != NULL) {
+        int pos = 0;
+        for (int i = 0; i < size; i++) {
+            for (int e = matrix.row_offsets[vertices[i]]; e < matrix.row_offsets[vertices[i] + 1]; e++) {
+                int col = local[matrix.col_indices[e]];
+                if (col < 0) continue;
+                sub.col_indices[pos] = col;
+                sub.values[pos] = matrix.values[e];
+                pos++;
+            }
+            sub.row_offsets[i + 1] = pos;
+        }
+        // L'ordre des sommets de la classe n'est pas celui des colonnes d'origine
+        sortSparseRows(sub, entries);
+    } else {
+        fprintf(stderr, "buildSparseSubMatrix: failed to create submatrix\n");
+        freeSparseMatrix(&sub);
+    }
+
+    free(entries);
+    free(local);
+    free(vertices);
+    return sub;
+}
+
+int computeSparseDistributionAfterNSteps(t_sparse_matrix transitionMatrix,
+                                         t_matrix initialDistribution,
+                                         int n,
+                                         t_matrix *result) {
+    if (isEmptySparseMatrix(transitionMatrix) || transitionMatrix.rows != transitionMatrix.cols) {
+        fprintf(stderr, "computeSparseDistributionAfterNSteps: invalid transition matrix\n");
+        return -1;
+    }
+    if (!isValidMatrix(initialDistribution) || initialDistribution.rows != 1 ||
+        initialDistribution.cols != transitionMatrix.rows) {
+        fprintf(stderr, "computeSparseDistributionAfterNSteps: initial distribution must be a 1x%d row vector\n",
+                transitionMatrix.rows);
+        return -1;
+    }
+    if (result == NULL) {
+        fprintf(stderr, "computeSparseDistributionAfterNSteps: NULL result pointer\n");
+        return -1;
+    }
+    if (n < 0) {
+        fprintf(stderr, "computeSparseDistributionAfterNSteps: n must be non-negative (given: %d)\n", n);
+        return -1;
+    }
+
+    t_matrix next = createMatrix(1, transitionMatrix.cols);
+    *result = createMatrix(1, transitionMatrix.cols);
+    if (!isValidMatrix(next) || !isValidMatrix(*result)) {
+        freeMatrix(&next);
+        freeMatrix(result);
+        return -1;
+    }
+    copyMatrix(initialDistribution, result);
+
+    // Deux vecteurs échangés à chaque pas : O(n.E) au total
+    for (int step = 0; step < n; step++) {
+        multiplyVectorSparseMatrix(result->data[0], transitionMatrix, next.data[0]);
+        t_matrix tmp = *result;
+        *result = next;
+        next = tmp;
+    }
+    freeMatrix(&next);
+    return 1;
+}
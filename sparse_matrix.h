@@ -0,0 +1,161 @@
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+#include "graph.h"
+#include "csr_graph.h"
+#include "partition.h"
+#include "matrix.h"
+
+/**
+ * @file sparse_matrix.h
+ * @brief Sparse matrices in compressed sparse row (CSR) form, with sparse-dense and sparse-sparse products.
+ *
+ * A sparse transition matrix holds only the E non-zero entries of a chain,
+ * so memory stays in O(N + E) where a t_matrix needs O(N^2).
+ */
+
+/**
+ * @struct s_sparse_matrix
+ * @brief Matrix of doubles storing only its non-zero entries, row by row.
+ * @param rows Number of rows.
+ * @param cols Number of columns.
+ * @param nnz Number of stored entries.
+ * @param row_offsets Array of rows + 1 entries: the entries of row i are at
+ *        indices [row_offsets[i], row_offsets[i + 1]) of col_indices and values.
+ * @param col_indices Zero-based column of each entry, increasing within a row.
+ * @param values Value of each entry.
+ * @note The CSC form of a matrix is the CSR form of its transpose, see
+ *       transposeSparseMatrix().
+ */
+typedef struct s_sparse_matrix {
+    int rows;
+    int cols;
+    int nnz;
+    int *row_offsets;
+    int *col_indices;
+    double *values;
+} t_sparse_matrix;
+
+/**
+ * @brief Create an empty (invalid) sparse matrix.
+ * @return A sparse matrix with no dimensions and NULL arrays.
+ */
+t_sparse_matrix createEmptySparseMatrix(void);
+
+/**
+ * @brief Check if a sparse matrix is empty (uninitialized).
+ * @param m Sparse matrix to inspect.
+ * @return 1 if empty, 0 otherwise.
+ */
+int isEmptySparseMatrix(t_sparse_matrix m);
+
+/**
+ * @brief Free all memory associated with a sparse matrix and reset its fields.
+ * @param m Pointer to the sparse matrix to free.
+ */
+void freeSparseMatrix(t_sparse_matrix *m);
+
+/**
+ * @brief Build the sparse transition matrix of a graph.
+ * @param graph Source graph.
+ * @param result Pointer to destination sparse matrix (allocated internally).
+ * @return 1 on success, -1 on error.
+ * @note Same entries as createMatrixFromGraph().
+ */
+int createSparseMatrixFromGraph(t_graph graph, t_sparse_matrix *result);
+
+/**
+ * @brief Build the sparse transition matrix of a CSR graph.
+ * @param graph Source CSR graph.
+ * @param result Pointer to destination sparse matrix (allocated internally).
+ * @return 1 on success, -1 on error.
+ * @note Same entries as createMatrixFromCsrGraph().
+ */
+int createSparseMatrixFromCsrGraph(t_csr_graph graph, t_sparse_matrix *result);
+
+/**
+ * @brief Compress a dense matrix, keeping its non-zero entries.
+ * @param m Dense matrix.
+ * @param result Pointer to destination sparse matrix (allocated internally).
+ * @return 1 on success, -1 on error.
+ */
+int createSparseMatrixFromMatrix(t_matrix m, t_sparse_matrix *result);
+
+/**
+ * @brief Expand a sparse matrix into a dense matrix.
+ * @param m Sparse matrix.
+ * @param result Pointer receiving the newly allocated dense matrix.
+ * @return 1 on success, -1 on error.
+ */
+int sparseToDenseMatrix(t_sparse_matrix m, t_matrix *result);
+
+/**
+ * @brief Transpose a sparse matrix (equivalently: convert it to CSC form).
+ * @param m Sparse matrix.
+ * @param result Pointer receiving the newly allocated transpose.
+ * @return 1 on success, -1 on error.
+ */
+int transposeSparseMatrix(t_sparse_matrix m, t_sparse_matrix *result);
+
+/**
+ * @brief Sparse matrix x column vector product: y = A x.
+ * @param a Sparse matrix.
+ * @param x Vector of a.cols entries.
+ * @param y Vector of a.rows entries receiving the result (must not alias x).
+ * @return 1 on success, -1 on error.
+ */
+int multiplySparseMatrixVector(t_sparse_matrix a, const double *x, double *y);
+
+/**
+ * @brief Row vector x sparse matrix product: y = x A (one step of a Markov chain).
+ * @param x Vector of a.rows entries.
+ * @param a Sparse matrix.
+ * @param y Vector of a.cols entries receiving the result (must not alias x).
+ * @return 1 on success, -1 on error.
+ */
+int multiplyVectorSparseMatrix(const double *x, t_sparse_matrix a, double *y);
+
+/**
+ * @brief Sparse x dense product (A x B), result allocated as a dense matrix.
+ * @param a Sparse left operand.
+ * @param b Dense right operand.
+ * @param result Pointer receiving the newly allocated result matrix.
+ * @return 1 on success, -1 on error.
+ */
+int multiplySparseDenseMatrices(t_sparse_matrix a, t_matrix b, t_matrix *result);
+
+/**
+ * @brief Sparse x sparse product (A x B), result allocated as a sparse matrix.
+ * @param a Sparse left operand.
+ * @param b Sparse right operand.
+ * @param result Pointer receiving the newly allocated result matrix.
+ * @return 1 on success, -1 on error.
+ * @note Row by row accumulation (Gustavson): O(rows + cols + flops) time.
+ *       Entries that cancel out to zero are kept.
+ */
+int multiplySparseMatrices(t_sparse_matrix a, t_sparse_matrix b, t_sparse_matrix *result);
+
+/**
+ * @brief Sparse version of buildSubMatrix(): the transitions inside one class.
+ * @param matrix The sparse transition matrix of the graph.
+ * @param part The partition of the graph into strongly connected components.
+ * @param class_id The id of the class to extract.
+ * @return The sparse submatrix, rows and columns in the order of the class
+ *         vertex list, or an empty sparse matrix on error.
+ */
+t_sparse_matrix buildSparseSubMatrix(t_sparse_matrix matrix, t_partition part, int class_id);
+
+/**
+ * @brief Sparse version of computeDistributionAfterNSteps(), in O(n.E).
+ * @param transitionMatrix The sparse transition matrix of the Markov chain.
+ * @param initialDistribution Initial probability distribution (1 x size row vector).
+ * @param n Number of steps (must be >= 0).
+ * @param result Pointer receiving the resulting distribution (1 x size row vector).
+ * @return 1 on success, -1 on error.
+ */
+int computeSparseDistributionAfterNSteps(t_sparse_matrix transitionMatrix,
+                                         t_matrix initialDistribution,
+                                         int n,
+                                         t_matrix *result);
+
+#endif //SPARSE_MATRIX_H
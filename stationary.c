@@ -0,0 +1,290 @@
+#include "stationary.h"
+#include "hasse.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @file stationary.c
+ * @brief Implementation of the vector stationary distribution solvers.
+ */
+
+/* private functions =================================================== */
+
+/**
+ * @brief L1 distance between two vectors.
+ */
+static double distanceL1(const double *a, const double *b, int size) {
+    double sum = 0.0;
+    for (int i = 0; i < size; i++) sum += fabs(a[i] - b[i]);
+    return sum;
+}
+
+/**
+ * @brief Scale a vector so that its entries sum to 1 (left unchanged if the sum is 0).
+ */
+static void normalizeDistribution(double *x, int size) {
+    double sum = 0.0;
+    for (int i = 0; i < size; i++) sum += x[i];
+    if (sum <= 0.0) return;
+    for (int i = 0; i < size; i++) x[i] /= sum;
+}
+
+/* public functions =================================================== */
+
+double stationaryResidual(t_sparse_matrix P, const double *distribution) {
+    if (isEmptySparseMatrix(P) || P.rows != P.cols || distribution == NULL) {
+        fprintf(stderr, "stationaryResidual: invalid parameters\n");
+        return -1;
+    }
+    double *image = malloc((size_t)P.cols * sizeof *image);
+    if (image == NULL) {
+        perror("stationaryResidual: allocation failed");
+        return -1;
+    }
+    multiplyVectorSparseMatrix(distribution, P, image);
+    double residual = distanceL1(image, distribution, P.cols);
+    free(image);
+    return residual;
+}
+
+int computeStationaryDistribution(t_sparse_matrix P, t_stationary_method method,
+                                  double tolerance, int maxIter, double *distribution) {
+    if (isEmptySparseMatrix(P) || P.rows != P.cols || distribution == NULL) {
+        fprintf(stderr, "computeStationaryDistribution: invalid parameters\n");
+        return -1;
+    }
+    if (tolerance <= 0.0 || maxIter <= 0) {
+        fprintf(stderr, "computeStationaryDistribution: tolerance and maxIter must be positive\n");
+        return -1;
+    }
+
+    int size = P.rows;
+    double *x = malloc((size_t)size * sizeof *x);
+    double *image = malloc((size_t)size * sizeof *image);
+    double *mean = (method == STATIONARY_CESARO) ? malloc((size_t)size * sizeof *mean) : NULL;
+    if (x == NULL || image == NULL || (method == STATIONARY_CESARO && mean == NULL)) {
+        perror("computeStationaryDistribution: allocation failed");
+        free(x);
+        free(image);
+        free(mean);
+        return -1;
+    }
+
+    // Départ uniforme : aucune composante nulle, donc pas de blocage sur un sous-cycle
+    for (int i = 0; i < size; i++) x[i] = 1.0 / size;
+    if (mean != NULL) memcpy(mean, x, (size_t)size * sizeof *x);
+
+    int iterations = -1;
+    for (int k = 0; k <= maxIter; k++) {
+        // Résidu de la réponse courante : x pour POWER/LAZY, la moyenne pour CESARO
+        const double *answer = (mean != NULL) ? mean : x;
+        multiplyVectorSparseMatrix(answer, P, image);
+        if (distanceL1(image, answer, size) < tolerance) {
+            iterations = k;
+            break;
+        }
+        if (k == maxIter) break;
+
+        switch (method) {
+            case STATIONARY_LAZY:
+                // Chaîne paresseuse (I + P) / 2 : apériodique, même distribution stationnaire
+                for (int i = 0; i < size; i++) x[i] = 0.5 * (x[i] + image[i]);
+                break;
+            case STATIONARY_CESARO:
+                // Moyenne de Cesàro des itérés x P^k : converge même sur une classe périodique
+                multiplyVectorSparseMatrix(x, P, image);
+                memcpy(x, image, (size_t)size * sizeof *x);
+                for (int i = 0; i < size; i++) mean[i] += (x[i] - mean[i]) / (k + 2);
+                break;
+            case STATIONARY_POWER:
+            default:
+                memcpy(x, image, (size_t)size * sizeof *x);
+                break;
+        }
+        // Corrige la dérive des arrondis : la masse totale reste 1
+        normalizeDistribution(x, size);
+        if (mean != NULL) normalizeDistribution(mean, size);
+    }
+
+    memcpy(distribution, (mean != NULL) ? mean : x, (size_t)size * sizeof *x);
+    free(x);
+    free(image);
+    free(mean);
+    return iterations;
+}
+
+int computeStationaryDistributionGTH(t_matrix P, double *distribution) {
+    if (!isValidMatrix(P) || P.rows != P.cols || distribution == NULL) {
+        fprintf(stderr, "computeStationaryDistributionGTH: invalid parameters\n");
+        return -1;
+    }
+    int size = P.rows;
+    t_matrix a = createMatrix(size, size);
+    if (!isValidMatrix(a)) return -1;
+    copyMatrix(P, &a);
+
+    // Élimination de l'état k : les transitions i -> k -> j sont reportées sur i -> j
+    for (int k = size - 1; k > 0; k--) {
+        double *row_k = getMatrixRow(a, k);
+        double leave = 0.0;
+        for (int j = 0; j < k; j++) leave += row_k[j];
+        if (leave <= 0.0) {
+            fprintf(stderr, "computeStationaryDistributionGTH: state %d cannot reach the states before it "
+                            "(class not irreducible)\n", k + 1);
+            freeMatrix(&a);
+            return -1;
+        }
+        for (int i = 0; i < k; i++) {
+            double *row_i = getMatrixRow(a, i);
+            double factor = row_i[k] / leave;
+            row_i[k] = factor;
+            if (factor == 0.0) continue;
+            for (int j = 0; j < k; j++) row_i[j] += factor * row_k[j];
+        }
+    }
+
+    // Remontée : pi[j] = somme des pi[i] a[i][j] pour i < j, puis normalisation
+    distribution[0] = 1.0;
+    for (int j = 1; j < size; j++) distribution[j] = 0.0;
+    for (int i = 0; i < size - 1; i++) {
+        const double *row_i = getMatrixRow(a, i);
+        double pi_i = distribution[i];
+        for (int j = i + 1; j < size; j++) distribution[j] += pi_i * row_i[j];
+    }
+    normalizeDistribution(distribution, size);
+    freeMatrix(&a);
+    return 1;
+}
+
+int computeStationaryDistributionLU(t_matrix P, double *distribution) {
+    if (!isValidMatrix(P) || P.rows != P.cols || distribution == NULL) {
+        fprintf(stderr, "computeStationaryDistributionLU: invalid parameters\n");
+        return -1;
+    }
+    int size = P.rows;
+    t_matrix a = createMatrix(size, size);
+    if (!isValidMatrix(a)) return -1;
+
+    // A = P^T - I, dernière ligne remplacée par sum(pi) = 1 : A pi = e_n
+    for (int i = 0; i < size - 1; i++) {
+        double *row = getMatrixRow(a, i);
+        for (int j = 0; j < size; j++) row[j] = P.data[j][i];
+        row[i] -= 1.0;
+    }
+    double *last = getMatrixRow(a, size - 1);
+    for (int j = 0; j < size; j++) last[j] = 1.0;
+    for (int i = 0; i < size; i++) distribution[i] = 0.0;
+    distribution[size - 1] = 1.0;
+
+    // Factorisation LU avec pivot partiel, appliquée directement au second membre
+    for (int k = 0; k < size; k++) {
+        int pivot = k;
+        for (int i = k + 1; i < size; i++) {
+            if (fabs(a.data[i][k]) > fabs(a.data[pivot][k])) pivot = i;
+        }
+        if (a.data[pivot][k] == 0.0) {
+            fprintf(stderr, "computeStationaryDistributionLU: singular system (class not irreducible)\n");
+            freeMatrix(&a);
+            return -1;
+        }
+        if (pivot != k) {
+            double *tmp = a.data[k];
+            a.data[k] = a.data[pivot];
+            a.data[pivot] = tmp;
+            double b = distribution[k];
+            distribution[k] = distribution[pivot];
+            distribution[pivot] = b;
+        }
+        const double *row_k = a.data[k];
+        for (int i = k + 1; i < size; i++) {
+            double *row_i = a.data[i];
+            double factor = row_i[k] / row_k[k];
+            if (factor == 0.0) continue;
+            row_i[k] = factor;
+            for (int j = k + 1; j < size; j++) row_i[j] -= factor * row_k[j];
+            distribution[i] -= factor * distribution[k];
+        }
+    }
+
+    // Substitution arrière sur U
+    for (int i = size - 1; i >= 0; i--) {
+        const double *row_i = a.data[i];
+        double sum = distribution[i];
+        for (int j = i + 1; j < size; j++) sum -= row_i[j] * distribution[j];
+        distribution[i] = sum / row_i[i];
+    }
+    freeMatrix(&a);
+    return 1;
+}
+
+t_stationary_solver chooseStationarySolver(int size, int nnz) {
+    if (size <= STATIONARY_DIRECT_MAX_SIZE &&
+        (double)size * size * size / 3.0 <= (double)STATIONARY_ITERATION_ESTIMATE * nnz) {
+        return STATIONARY_SOLVER_GTH;
+    }
+    return STATIONARY_SOLVER_ITERATIVE;
+}
+
+int computeStationaryPeriod(t_sparse_matrix P) {
+    if (isEmptySparseMatrix(P) || P.rows != P.cols) {
+        fprintf(stderr, "computeStationaryPeriod: invalid parameters\n");
+        return -1;
+    }
+    // Une seule classe explorée depuis l'état 0 : irréductible si tous les états sont atteints
+    int periods[2];
+    int reached = computeBfsPeriods(P.rows, P.row_offsets, P.col_indices, 0, P.values, NULL, 1, periods);
+    if (reached < 0) return -1;
+    return (reached == P.rows) ? periods[1] : 0;
+}
+
+t_stationary_method chooseStationaryMethod(int period) {
+    return (period == 1) ? STATIONARY_POWER : STATIONARY_LAZY;
+}
+
+int solveStationaryDistributionWithPeriod(t_sparse_matrix P, t_stationary_solver solver, int period,
+                                          double tolerance, double *distribution) {
+    if (isEmptySparseMatrix(P) || P.rows != P.cols || distribution == NULL) {
+        fprintf(stderr, "solveStationaryDistribution: invalid parameters\n");
+        return -1;
+    }
+    if (solver == STATIONARY_SOLVER_AUTO) solver = chooseStationarySolver(P.rows, P.nnz);
+
+    if (solver == STATIONARY_SOLVER_GTH || solver == STATIONARY_SOLVER_LU) {
+        t_matrix dense;
+        if (sparseToDenseMatrix(P, &dense) == 1) {
+            int status = (solver == STATIONARY_SOLVER_GTH)
+                         ? computeStationaryDistributionGTH(dense, distribution)
+                         : computeStationaryDistributionLU(dense, distribution);
+            freeMatrix(&dense);
+            if (status == 1) return 1;
+        }
+        fprintf(stderr, "solveStationaryDistribution: %s solver failed, falling back to iterations\n",
+                getStationarySolverName(solver));
+    }
+
+    // La période n'est calculée que pour les itérations, en O(nnz)
+    if (period <= 0) period = computeStationaryPeriod(P);
+    t_stationary_method method = chooseStationaryMethod(period);
+    if (computeStationaryDistribution(P, method, tolerance, STATIONARY_MAX_ITERATIONS, distribution) >= 0) {
+        return 1;
+    }
+    // Apériodique mais presque périodique (valeur propre proche de -1) : la chaîne paresseuse converge mieux
+    if (method == STATIONARY_LAZY) return -1;
+    return computeStationaryDistribution(P, STATIONARY_LAZY, tolerance, STATIONARY_MAX_ITERATIONS,
+                                         distribution) >= 0 ? 1 : -1;
+}
+
+int solveStationaryDistribution(t_sparse_matrix P, t_stationary_solver solver,
+                                double tolerance, double *distribution) {
+    return solveStationaryDistributionWithPeriod(P, solver, 0, tolerance, distribution);
+}
+
+const char *getStationarySolverName(t_stationary_solver solver) {
+    switch (solver) {
+        case STATIONARY_SOLVER_AUTO: return "auto";
+        case STATIONARY_SOLVER_GTH: return "gth";
+        case STATIONARY_SOLVER_LU: return "lu";
+        case STATIONARY_SOLVER_ITERATIVE: return "iterative";
+        default: return "unknown";
+    }
+}
@@ -0,0 +1,172 @@
+#ifndef STATIONARY_H
+#define STATIONARY_H
+
+#include "sparse_matrix.h"
+
+/**
+ * @file stationary.h
+ * @brief Stationary distribution of an irreducible class, pi = pi x P, computed on vectors.
+ *
+ * Every iteration is one row vector x sparse matrix product, O(E), instead
+ * of the O(N^3) product of a converged matrix power. Small and dense
+ * classes are solved directly (GTH or LU elimination, O(N^3 / 3) once),
+ * see solveStationaryDistribution().
+ */
+
+/** Default residual threshold: vector iterations are cheap, so solve to near machine precision. */
+#define STATIONARY_DEFAULT_TOLERANCE 1e-10
+
+/** Default iteration cap of the stationary solvers. */
+#define STATIONARY_MAX_ITERATIONS 100000
+
+/** Largest class solved by a direct method in STATIONARY_SOLVER_AUTO mode (N^2 doubles of storage). */
+#define STATIONARY_DIRECT_MAX_SIZE 4000
+
+/** Number of iterations assumed by STATIONARY_SOLVER_AUTO to compare iterative and direct costs. */
+#define STATIONARY_ITERATION_ESTIMATE 1000
+
+/**
+ * @enum e_stationary_method
+ * @brief Iteration used by computeStationaryDistribution().
+ */
+typedef enum e_stationary_method {
+    STATIONARY_POWER,   /**< x <- x P: fastest, never converges on a periodic class */
+    STATIONARY_LAZY,    /**< x <- (x + x P) / 2: the lazy chain is aperiodic and has the same pi */
+    STATIONARY_CESARO   /**< x <- x P, answer is the running mean of the iterates */
+} t_stationary_method;
+
+/**
+ * @brief Compute the stationary distribution of an irreducible stochastic matrix.
+ *
+ * Starts from the uniform distribution and stops as soon as the residual
+ * ||pi P - pi||_1 of the current answer is below tolerance.
+ *
+ * @param P Transition matrix of the class (square, rows summing to 1).
+ * @param method Iteration to use, see chooseStationaryMethod().
+ * @param tolerance Residual threshold (> 0).
+ * @param maxIter Iteration cap (> 0), e.g. STATIONARY_MAX_ITERATIONS.
+ * @param distribution Array of P.rows entries receiving the distribution
+ *        (the last iterate when the cap is reached).
+ * @return Number of iterations on convergence, -1 on error or if maxIter is reached.
+ */
+int computeStationaryDistribution(t_sparse_matrix P, t_stationary_method method,
+                                  double tolerance, int maxIter, double *distribution);
+
+/**
+ * @brief Residual ||pi P - pi||_1 of a candidate stationary distribution.
+ * @param P Square transition matrix.
+ * @param distribution Array of P.rows entries.
+ * @return The residual, or -1 on error.
+ */
+double stationaryResidual(t_sparse_matrix P, const double *distribution);
+
+/**
+ * @enum e_stationary_solver
+ * @brief Solver used by solveStationaryDistribution().
+ */
+typedef enum e_stationary_solver {
+    STATIONARY_SOLVER_AUTO,         /**< Chosen by chooseStationarySolver() */
+    STATIONARY_SOLVER_GTH,          /**< Grassmann-Taksar-Heyman elimination */
+    STATIONARY_SOLVER_LU,           /**< LU factorization with partial pivoting */
+    STATIONARY_SOLVER_ITERATIVE     /**< Power iteration, lazy on periodic classes, see chooseStationaryMethod() */
+} t_stationary_solver;
+
+/**
+ * @brief Stationary distribution by Grassmann-Taksar-Heyman elimination.
+ *
+ * Gaussian elimination on the states in reverse order, where the pivot is
+ * the sum of the off-diagonal entries of its row: no subtraction is ever
+ * done, so the result is accurate to machine precision even for nearly
+ * uncoupled chains.
+ *
+ * @param P Transition matrix of an irreducible class (square, rows summing to 1).
+ * @param distribution Array of P.rows entries receiving the distribution.
+ * @return 1 on success, -1 on error (including a reducible P).
+ */
+int computeStationaryDistributionGTH(t_matrix P, double *distribution);
+
+/**
+ * @brief Stationary distribution by solving (P^T - I) pi = 0, sum(pi) = 1 with an LU factorization.
+ *
+ * The last equation of the singular system is replaced by the normalization.
+ *
+ * @param P Transition matrix of an irreducible class (square, rows summing to 1).
+ * @param distribution Array of P.rows entries receiving the distribution.
+ * @return 1 on success, -1 on error (including a singular system).
+ */
+int computeStationaryDistributionLU(t_matrix P, double *distribution);
+
+/**
+ * @brief Pick the cheapest solver for a class.
+ *
+ * A direct solve costs about N^3 / 3 operations, an iterative one about
+ * STATIONARY_ITERATION_ESTIMATE x nnz: the direct GTH solver is chosen when
+ * it is cheaper and the class has at most STATIONARY_DIRECT_MAX_SIZE states.
+ *
+ * @param size Number of states of the class.
+ * @param nnz Number of transitions inside the class.
+ * @return STATIONARY_SOLVER_GTH or STATIONARY_SOLVER_ITERATIVE.
+ */
+t_stationary_solver chooseStationarySolver(int size, int nnz);
+
+/**
+ * @brief Period of an irreducible transition matrix, in O(N + nnz).
+ *
+ * BFS levels from state 0, see computeBfsPeriods(): every transition u -> v closes cycles whose
+ * lengths differ from level(u) + 1 - level(v) by a multiple of the period,
+ * which is the gcd of these gaps.
+ *
+ * @param P Square transition matrix of an irreducible class (zero entries are ignored).
+ * @return The period (1 if aperiodic), 0 if P is not irreducible or has no cycle, -1 on error.
+ */
+int computeStationaryPeriod(t_sparse_matrix P);
+
+/**
+ * @brief Iteration suited to a class of a given period.
+ *
+ * x <- x P converges on an aperiodic class, in about half the iterations of the lazy
+ * chain; a periodic class (or an unknown period) needs STATIONARY_LAZY.
+ *
+ * @param period Period of the class, <= 0 if unknown.
+ * @return STATIONARY_POWER if period == 1, STATIONARY_LAZY otherwise.
+ */
+t_stationary_method chooseStationaryMethod(int period);
+
+/**
+ * @brief Stationary distribution of an irreducible class with the chosen solver.
+ * @param P Transition matrix of the class (square, rows summing to 1).
+ * @param solver Solver to use, STATIONARY_SOLVER_AUTO to let chooseStationarySolver() decide.
+ * @param tolerance Residual threshold of the iterative solver (> 0).
+ * @param distribution Array of P.rows entries receiving the distribution.
+ * @return 1 on success, -1 on error or if the iterative solver does not converge.
+ * @note A direct solver that fails falls back to the iterative one, whose
+ *       method is picked from the period, see solveStationaryDistributionWithPeriod().
+ */
+int solveStationaryDistribution(t_sparse_matrix P, t_stationary_solver solver,
+                                double tolerance, double *distribution);
+
+/**
+ * @brief Same as solveStationaryDistribution(), with the period of the class already known.
+ *
+ * The iterative solver uses chooseStationaryMethod(period), so a periodic
+ * class never runs into the iteration cap of STATIONARY_POWER. An aperiodic
+ * class that still does not converge is retried with STATIONARY_LAZY.
+ *
+ * @param P Transition matrix of the class (square, rows summing to 1).
+ * @param solver Solver to use, STATIONARY_SOLVER_AUTO to let chooseStationarySolver() decide.
+ * @param period Period of the class (e.g. t_class.period), <= 0 to compute it with computeStationaryPeriod().
+ * @param tolerance Residual threshold of the iterative solver (> 0).
+ * @param distribution Array of P.rows entries receiving the distribution.
+ * @return 1 on success, -1 on error or if the iterative solver does not converge.
+ */
+int solveStationaryDistributionWithPeriod(t_sparse_matrix P, t_stationary_solver solver, int period,
+                                          double tolerance, double *distribution);
+
+/**
+ * @brief Name of a solver ("auto", "gth", "lu" or "iterative").
+ * @param solver Solver.
+ * @return Static string.
+ */
+const char *getStationarySolverName(t_stationary_solver solver);
+
+#endif //STATIONARY_H
@@ -25,24 +25,20 @@ void freeTarjanVerticesPartial(t_tarjan_vertex **tarjan_vertices, int count) {
 }
 
 /**
- * @brief Converts a graph into an array of Tarjan vertices.
- *
- * Creates one Tarjan vertex for each vertex in the graph, all initialized
- * as unvisited and not on the stack.
+ * @brief Creates one unvisited Tarjan vertex per vertex of a graph.
  *
- * @param graph The graph to convert.
+ * @param size Number of vertices of the graph.
  * @return Array of Tarjan vertices, or NULL on allocation failure.
  */
-t_tarjan_vertex** graphToTarjanVertices(t_graph graph) {
-    int size = graph.size;
+static t_tarjan_vertex** createTarjanVertices(int size) {
     if (size <= 0) {
-        fprintf(stderr, "graphToTarjanVertices: invalid graph size\n");
+        fprintf(stderr, "createTarjanVertices: invalid graph size\n");
         return NULL;
     }
 
     t_tarjan_vertex **tarjan_vertices = calloc(size, sizeof(t_tarjan_vertex*));
     if (tarjan_vertices == NULL) {
-        perror("graphToTarjanVertices: allocation failed");
+        perror("createTarjanVertices: allocation failed");
         return NULL;
     }
 
@@ -50,7 +46,7 @@ t_tarjan_vertex** graphToTarjanVertices(t_graph graph) {
         int vertex_id = i + 1;
         tarjan_vertices[i] = createTarjanVertex(vertex_id, UNVISITED, UNVISITED, FALSE);
         if (tarjan_vertices[i] == NULL) {
-            perror("graphToTarjanVertices: vertex creation failed");
+            perror("createTarjanVertices: vertex creation failed");
             freeTarjanVerticesPartial(tarjan_vertices, i);
             return NULL;
         }
@@ -59,6 +55,19 @@ t_tarjan_vertex** graphToTarjanVertices(t_graph graph) {
     return tarjan_vertices;
 }
 
+/**
+ * @brief Converts a graph into an array of Tarjan vertices.
+ *
+ * Creates one Tarjan vertex for each vertex in the graph, all initialized
+ * as unvisited and not on the stack.
+ *
+ * @param graph The graph to convert.
+ * @return Array of Tarjan vertices, or NULL on allocation failure.
+ */
+t_tarjan_vertex** graphToTarjanVertices(t_graph graph) {
+    return createTarjanVertices(graph.size);
+}
+
 /**
  * @brief Initializes a Tarjan vertex during the first visit.
  *
@@ -145,20 +154,16 @@ void visitTarjanNeighbors(
 }
 
 /**
- * @brief Extracts a strongly connected component from the stack.
- *
- * When a root vertex is found (num_accessible == num), all vertices on the stack
- * up to and including this vertex form one SCC. This function pops them off
- * and creates a new class in the partition.
+ * @brief Pops one strongly connected component from the stack into a new class.
  *
- * @param graph The graph being traversed.
+ * @param size Number of vertices of the graph being traversed.
  * @param tarjan_vertices Array of all Tarjan vertices.
  * @param curr The root vertex of the SCC.
  * @param partition The partition to add the new class to.
  * @param stack The DFS stack.
  */
-void extractStronglyConnectedComponent(
-        t_graph *graph,
+static void popStronglyConnectedComponent(
+        int size,
         t_tarjan_vertex **tarjan_vertices,
         t_tarjan_vertex *curr,
         t_partition *partition,
@@ -175,7 +180,7 @@ void extractStronglyConnectedComponent(
     do {
         if (stack->top == NULL) break;
         w_id = popStack(stack);
-        if (w_id == STACK_EMPTY || w_id < 1 || w_id > graph->size) break;
+        if (w_id == STACK_EMPTY || w_id < 1 || w_id > size) break;
 
         t_tarjan_vertex *w_tv = tarjan_vertices[w_id - 1];
         w_tv->in_pile = FALSE;
@@ -191,6 +196,28 @@ void extractStronglyConnectedComponent(
     }
 }
 
+/**
+ * @brief Extracts a strongly connected component from the stack.
+ *
+ * When a root vertex is found (num_accessible == num), all vertices on the stack
+ * up to and including this vertex form one SCC. This function pops them off
+ * and creates a new class in the partition.
+ *
+ * @param graph The graph being traversed.
+ * @param tarjan_vertices Array of all Tarjan vertices.
+ * @param curr The root vertex of the SCC.
+ * @param partition The partition to add the new class to.
+ * @param stack The DFS stack.
+ */
+void extractStronglyConnectedComponent(
+        t_graph *graph,
+        t_tarjan_vertex **tarjan_vertices,
+        t_tarjan_vertex *curr,
+        t_partition *partition,
+        t_stack *stack) {
+    popStronglyConnectedComponent(graph->size, tarjan_vertices, curr, partition, stack);
+}
+
 /**
  * @brief Performs a DFS visit on a vertex using Tarjan's algorithm.
  *
@@ -238,7 +265,62 @@ void tarjanVisit(
     }
 }
 
-t_partition *tarjan(t_graph graph) {
+/**
+ * @brief Performs a DFS visit on a vertex of a CSR graph using Tarjan's algorithm.
+ *
+ * Same traversal as tarjanVisit(), but neighbors are read from the contiguous
+ * CSR arrays instead of the adjacency lists.
+ *
+ * @param graph The CSR graph being traversed.
+ * @param tarjan_vertices Array of all Tarjan vertices.
+ * @param vertex_id ID of the vertex to visit.
+ * @param current_num Pointer to the current discovery number.
+ * @param partition The partition being built.
+ * @param stack The DFS stack.
+ */
+static void tarjanCsrVisit(
+        t_csr_graph *graph,
+        t_tarjan_vertex **tarjan_vertices,
+        int vertex_id,
+        int *current_num,
+        t_partition *partition,
+        t_stack *stack) {
+    t_tarjan_vertex *curr = tarjan_vertices[vertex_id - 1];
+
+    // Initialize this vertex (first visit)
+    initializeTarjanVertex(curr, current_num, stack);
+
+    // Visit all neighbors
+    for (int e = graph->offsets[vertex_id - 1]; e < graph->offsets[vertex_id]; e++) {
+        t_tarjan_vertex *neighbor_tv = tarjan_vertices[graph->targets[e] - 1];
+
+        if (neighbor_tv->num == UNVISITED) {
+            tarjanCsrVisit(graph, tarjan_vertices, neighbor_tv->id, current_num, partition, stack);
+            curr->num_accessible = minInt(curr->num_accessible, neighbor_tv->num_accessible);
+        } else if (neighbor_tv->in_pile == TRUE) {
+            curr->num_accessible = minInt(curr->num_accessible, neighbor_tv->num);
+        }
+    }
+
+    // Check if this vertex is the root of an SCC
+    if (curr->num_accessible == curr->num) {
+        popStronglyConnectedComponent(graph->size, tarjan_vertices, curr, partition, stack);
+    }
+}
+
+/**
+ * @brief Runs the recursive Tarjan's algorithm on either representation of a graph.
+ *
+ * Exactly one of graph and csr must be non-NULL. The recursion depth is the
+ * length of the longest DFS path: long chains overflow the C stack.
+ *
+ * @param graph Adjacency list graph, or NULL.
+ * @param csr CSR graph, or NULL.
+ * @return Pointer to the partition, or NULL on allocation failure.
+ */
+static t_partition *runTarjanRecursive(t_graph *graph, t_csr_graph *csr) {
+    int size = (csr != NULL) ? csr->size : graph->size;
+
     // Step 1: Create empty partition
     printf("Step 1: Creating partition structure...\n");
     t_partition *partition = createPartition();
@@ -247,16 +329,16 @@ t_partition *tarjan(t_graph graph) {
         return NULL;
     }
 
-    if (graph.size <= 0) {
+    if (size <= 0) {
         printf("Warning: Graph is empty\n");
         return partition;
     }
 
-    printf("Graph size: %d vertices\n", graph.size);
+    printf("Graph size: %d vertices\n", size);
 
     // Step 2: Convert graph to Tarjan vertices
     printf("Step 2: Initializing Tarjan data structures...\n");
-    t_tarjan_vertex **tarjan_vertices = graphToTarjanVertices(graph);
+    t_tarjan_vertex **tarjan_vertices = createTarjanVertices(size);
     if (tarjan_vertices == NULL) {
         fprintf(stderr, "Error: Failed to create Tarjan vertices\n");
         freePartition(partition);
@@ -267,7 +349,7 @@ t_partition *tarjan(t_graph graph) {
     t_stack *stack = createStack();
     if (stack == NULL) {
         fprintf(stderr, "Error: Failed to create stack\n");
-        freeTarjanVerticesPartial(tarjan_vertices, graph.size);
+        freeTarjanVerticesPartial(tarjan_vertices, size);
         freePartition(partition);
         return NULL;
     }
@@ -277,12 +359,16 @@ t_partition *tarjan(t_graph graph) {
     int current_num = 0;
     int components_found = 0;
 
-    for (int i = 0; i < graph.size; i++) {
+    for (int i = 0; i < size; i++) {
         if (tarjan_vertices[i] == NULL) continue;
         if (tarjan_vertices[i]->num == UNVISITED) {
             printf("  Starting DFS from vertex %d\n", tarjan_vertices[i]->id);
             int previous_class_count = partition->class_number;
-            tarjanVisit(&graph, tarjan_vertices, tarjan_vertices[i]->id, &current_num, partition, stack);
+            if (csr != NULL) {
+                tarjanCsrVisit(csr, tarjan_vertices, tarjan_vertices[i]->id, &current_num, partition, stack);
+            } else {
+                tarjanVisit(graph, tarjan_vertices, tarjan_vertices[i]->id, &current_num, partition, stack);
+            }
 
             // Check if new components were found
             if (partition->class_number > previous_class_count) {
@@ -292,7 +378,7 @@ t_partition *tarjan(t_graph graph) {
     }
 
     // Step 5: Clean up
-    freeTarjanVerticesPartial(tarjan_vertices, graph.size);
+    freeTarjanVerticesPartial(tarjan_vertices, size);
     freeStack(stack);
 
     printf("Step 4: Complete!\n");
@@ -301,3 +387,209 @@ t_partition *tarjan(t_graph graph) {
 
     return partition;
 }
+
+
+/**
+ * @brief Flat state of the iterative Tarjan's algorithm (0-based vertices).
+ * @param num Discovery number of each vertex, UNVISITED if not reached yet.
+ * @param num_accessible Low-link value of each vertex.
+ * @param in_pile TRUE while the vertex is on the SCC stack.
+ * @param pile SCC stack of vertices, pile_size entries.
+ * @param calls DFS path (explicit call stack), depth entries.
+ * @param cells Next adjacency cell to visit for each vertex (list graphs).
+ * @param edges Next CSR edge to visit for each vertex (CSR graphs).
+ */
+typedef struct s_tarjan_state {
+    int *num;
+    int *num_accessible;
+    char *in_pile;
+    int *pile;
+    int pile_size;
+    int *calls;
+    int depth;
+    t_cell **cells;
+    int *edges;
+} t_tarjan_state;
+
+static void freeTarjanState(t_tarjan_state *state) {
+    free(state->num);
+    free(state->num_accessible);
+    free(state->in_pile);
+    free(state->pile);
+    free(state->calls);
+    free(state->cells);
+    free(state->edges);
+}
+
+/**
+ * @brief Allocates the flat arrays of the iterative Tarjan's algorithm.
+ * @param size Number of vertices.
+ * @param list_graph TRUE to allocate list cursors, FALSE for CSR cursors.
+ * @param state State to fill.
+ * @return 1 on success, -1 on allocation failure.
+ */
+static int createTarjanState(int size, int list_graph, t_tarjan_state *state) {
+    *state = (t_tarjan_state){ 0 };
+    state->num = malloc((size_t)size * sizeof *state->num);
+    state->num_accessible = malloc((size_t)size * sizeof *state->num_accessible);
+    state->in_pile = calloc((size_t)size, sizeof *state->in_pile);
+    state->pile = malloc((size_t)size * sizeof *state->pile);
+    state->calls = malloc((size_t)size * sizeof *state->calls);
+    if (list_graph) {
+        state->cells = malloc((size_t)size * sizeof *state->cells);
+    } else {
+        state->edges = malloc((size_t)size * sizeof *state->edges);
+    }
+    if (state->num == NULL || state->num_accessible == NULL || state->in_pile == NULL ||
+        state->pile == NULL || state->calls == NULL || (state->cells == NULL && state->edges == NULL)) {
+        perror("createTarjanState: allocation failed");
+        freeTarjanState(state);
+        return -1;
+    }
+    for (int v = 0; v < size; v++) state->num[v] = UNVISITED;
+    return 1;
+}
+
+/**
+ * @brief First visit of a vertex: numbering, push on both stacks, neighbor cursor at the start.
+ */
+static void enterTarjanVertex(t_tarjan_state *state, t_graph *graph, t_csr_graph *csr, int v, int *current_num) {
+    state->num[v] = *current_num;
+    state->num_accessible[v] = *current_num;
+    (*current_num)++;
+    state->pile[state->pile_size++] = v;
+    state->in_pile[v] = TRUE;
+    state->calls[state->depth++] = v;
+    if (csr != NULL) {
+        state->edges[v] = csr->offsets[v];
+    } else {
+        state->cells[v] = graph->values[v].head;
+    }
+}
+
+/**
+ * @brief Next neighbor of v in adjacency order, advancing its cursor.
+ * @return The 0-based neighbor, or -1 when all neighbors have been visited.
+ */
+static int nextTarjanNeighbor(t_tarjan_state *state, t_graph *graph, t_csr_graph *csr, int v) {
+    if (csr != NULL) {
+        if (state->edges[v] >= csr->offsets[v + 1]) return -1;
+        return csr->targets[state->edges[v]++] - 1;
+    }
+    t_cell *cell = state->cells[v];
+    if (cell == NULL) return -1;
+    state->cells[v] = cell->next;
+    (void)graph;
+    return cell->vertex - 1;
+}
+
+/**
+ * @brief Pops the SCC rooted at root from the flat stack into a new class.
+ */
+static void popTarjanComponent(t_tarjan_state *state, int root, t_partition *partition) {
+    t_class *new_class = createClass(generateClassId(*partition));
+    if (new_class == NULL) return;
+    int w;
+    do {
+        w = state->pile[--state->pile_size];
+        state->in_pile[w] = FALSE;
+        addVertexToClass(new_class, w + 1);
+    } while (w != root);
+    addClassToPartition(partition, new_class);
+}
+
+/**
+ * @brief Runs Tarjan's algorithm on either representation of a graph, without recursion.
+ *
+ * Exactly one of graph and csr must be non-NULL. The DFS path is kept in an
+ * explicit array and every vertex remembers its next neighbor, so the depth
+ * is only limited by memory. Vertices, neighbors and SCCs are visited in the
+ * same order as the recursive version, which gives the same partition.
+ *
+ * @param graph Adjacency list graph, or NULL.
+ * @param csr CSR graph, or NULL.
+ * @return Pointer to the partition, or NULL on allocation failure.
+ */
+static t_partition *runTarjan(t_graph *graph, t_csr_graph *csr) {
+    int size = (csr != NULL) ? csr->size : graph->size;
+
+    // Step 1: Create empty partition
+    printf("Step 1: Creating partition structure...\n");
+    t_partition *partition = createPartition();
+    if (partition == NULL) {
+        fprintf(stderr, "Error: Failed to create partition\n");
+        return NULL;
+    }
+
+    if (size <= 0) {
+        printf("Warning: Graph is empty\n");
+        return partition;
+    }
+
+    printf("Graph size: %d vertices\n", size);
+
+    // Step 2: Flat arrays instead of one Tarjan vertex per vertex and a linked stack
+    printf("Step 2: Initializing Tarjan data structures...\n");
+    t_tarjan_state state;
+    if (createTarjanState(size, csr == NULL, &state) < 0) {
+        fprintf(stderr, "Error: Failed to create Tarjan data structures\n");
+        freePartition(partition);
+        return NULL;
+    }
+
+    // Step 3: Run Tarjan's algorithm
+    printf("Step 3: Running depth-first search to identify SCCs...\n");
+    int current_num = 0;
+
+    for (int root = 0; root < size; root++) {
+        if (state.num[root] != UNVISITED) continue;
+        printf("  Starting DFS from vertex %d\n", root + 1);
+        enterTarjanVertex(&state, graph, csr, root, &current_num);
+
+        while (state.depth > 0) {
+            int v = state.calls[state.depth - 1];
+            int w = nextTarjanNeighbor(&state, graph, csr, v);
+            if (w >= 0) {
+                if (state.num[w] == UNVISITED) {
+                    // Équivalent de l'appel récursif : w passe au sommet du chemin
+                    enterTarjanVertex(&state, graph, csr, w, &current_num);
+                } else if (state.in_pile[w]) {
+                    state.num_accessible[v] = minInt(state.num_accessible[v], state.num[w]);
+                }
+                continue;
+            }
+
+            // Tous les voisins de v sont traités : retour dans le parent
+            state.depth--;
+            if (state.num_accessible[v] == state.num[v]) {
+                popTarjanComponent(&state, v, partition);
+            }
+            if (state.depth > 0) {
+                int parent = state.calls[state.depth - 1];
+                state.num_accessible[parent] = minInt(state.num_accessible[parent], state.num_accessible[v]);
+            }
+        }
+    }
+
+    // Step 4: Clean up
+    freeTarjanState(&state);
+
+    printf("Step 4: Complete!\n");
+    printf("Found %d strongly connected component(s)\n", partition->class_number);
+    printf("\n");
+
+    return partition;
+}
+
+
+t_partition *tarjan(t_graph graph) {
+    return runTarjan(&graph, NULL);
+}
+
+t_partition *tarjanCsr(t_csr_graph graph) {
+    return runTarjan(NULL, &graph);
+}
+
+t_partition *tarjanRecursive(t_graph graph) {
+    return runTarjanRecursive(&graph, NULL);
+}
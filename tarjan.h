@@ -5,6 +5,7 @@
 
 #include "partition.h"
 #include "graph.h"
+#include "csr_graph.h"
 #include "tarjan_vertex.h"
 #include "utils.h"
 
@@ -13,6 +14,8 @@
  *
  * This function applies Tarjan's algorithm to partition the graph into its strongly
  * connected components (SCCs). Each SCC becomes a class in the returned partition.
+ * The DFS is iterative (explicit stack over flat arrays), so the graph size is
+ * not limited by the C stack.
  *
  * @param graph The graph to analyze. Must have size > 0 for meaningful results.
  * @return Pointer to a partition containing all strongly connected components.
@@ -22,6 +25,32 @@
  */
 t_partition *tarjan(t_graph graph);
 
+/**
+ * @brief Computes the strongly connected components of a CSR graph using Tarjan's algorithm.
+ *
+ * Same algorithm and same resulting partition as tarjan(), with neighbors read
+ * from contiguous arrays instead of adjacency lists.
+ *
+ * @param graph The CSR graph to analyze.
+ * @return Pointer to a partition containing all strongly connected components.
+ *         Returns an empty partition if graph is empty.
+ *         Returns NULL on memory allocation failure.
+ *         Caller must free with freePartition().
+ */
+t_partition *tarjanCsr(t_csr_graph graph);
+
+/**
+ * @brief Recursive version of tarjan(), one C stack frame per DFS level.
+ *
+ * Same partition as tarjan(); kept for comparison. Long chains (around
+ * 100k states and more) overflow the C stack.
+ *
+ * @param graph The graph to analyze.
+ * @return Pointer to a partition containing all strongly connected components,
+ *         or NULL on memory allocation failure. Caller must free with freePartition().
+ */
+t_partition *tarjanRecursive(t_graph graph);
+
 /**
  * @brief Frees a partially allocated array of Tarjan vertices.
  *
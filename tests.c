@@ -1,5 +1,10 @@
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 #include "tests.h"
 #include "graph.h"
 #include "partition.h"
@@ -8,6 +13,17 @@
 #include "tarjan.h"
 #include "tarjan_vertex.h"
 #include "hasse.h"
+#include "csr_graph.h"
+#include "matrix.h"
+#include "graph_loader.h"
+#include "graph_binary.h"
+#include "propagation.h"
+#include "sparse_matrix.h"
+#include "stationary.h"
+#include "scc.h"
+#include "absorption.h"
+#include "hitting.h"
+#include "simulation.h"
 
 static test_entry g_tests[256];
 static int g_test_count = 0;
@@ -171,6 +187,44 @@ static int test_graph_free(void) {
     return 0;
 }
 
+// Test graphe à arène : les cellules sont allouées par blocs
+static int test_graph_arena_edges(void) {
+    t_graph g = createArenaGraph(2);
+    if (g.arena == NULL) { freeGraph(&g); return 1; }
+    for (int i = 0; i < CELL_ARENA_CHUNK_SIZE + 1; i++) {
+        addEdge(&g, 1, 2, 0.5);
+    }
+    int result = (hasEdge(g, 1, 2) && !hasEdge(g, 2, 1) && g.arena->chunk_count == 2) ? 0 : 1;
+    freeGraph(&g);
+    return result;
+}
+
+// Test libération d'un graphe à arène
+static int test_graph_arena_free(void) {
+    t_graph g = createArenaGraph(3);
+    addEdge(&g, 1, 2, 1.0);
+    addEdge(&g, 2, 3, 1.0);
+    freeGraph(&g);
+    return (g.values == NULL && g.arena == NULL && g.size == 0) ? 0 : 1;
+}
+
+// Test comparaison de graphes : poids, ordre des listes et taille comptent
+static int test_graph_same(void) {
+    t_graph a = createGraph(3), b = createArenaGraph(3);
+    addEdge(&a, 1, 2, 0.5);
+    addEdge(&a, 1, 3, 0.5);
+    addEdge(&b, 1, 2, 0.5);
+    addEdge(&b, 1, 3, 0.5);
+    int result = isSameGraph(a, b) ? 0 : 1;
+    addEdge(&b, 3, 3, 1.0);
+    if (isSameGraph(a, b)) result = 1;
+    t_graph c = createGraph(2);
+    if (isSameGraph(a, c)) result = 1;
+    freeGraph(&a);
+    freeGraph(&b);
+    freeGraph(&c);
+    return result;
+}
 
 // Tests pour l'importation de graphes
 // Test lecture d'un fichier valide
@@ -191,6 +245,90 @@ static int test_read_file_nonexistent(void) {
 }
 
 
+// Test tokenizer : mêmes graphes que le chargeur fscanf sur tous les exemples
+static int test_read_file_matches_scanf(void) {
+    const char *paths[] = {
+        "../data/exemple1.txt", "../data/exemple2.txt", "../data/exemple3.txt",
+        "../data/exemple4_2check.txt", "../data/exemple1_from_chatGPT.txt", "../data/exemple_valid_step3.txt"
+    };
+    for (int i = 0; i < (int)(sizeof(paths)/sizeof(paths[0])); i++) {
+        t_graph g1 = importGraphFromFileWithScanf(paths[i]);
+        t_graph g2 = importGraphFromFile(paths[i]);
+        int same = (g1.size > 0 && isSameGraph(g1, g2));
+        freeGraph(&g1);
+        freeGraph(&g2);
+        if (!same) return 1;
+    }
+    return 0;
+}
+
+// Test tokenizer : syntaxes numériques inhabituelles et arrêt sur texte invalide
+static int test_read_file_number_formats(void) {
+    const char *path = "test_reader_formats.txt";
+    FILE *file = fopen(path, "w");
+    if (file == NULL) return 1;
+    fprintf(file, "  3\r\n1 2 0.5e0\n+1 3 .25\n2\t2 1\n3 1 1.00000000000000000000000001\n"
+                  "3 2 0x1p-2\n2 3 -0\n1 1 1e-30\n3 3 7abc\n3 1 0.5\n");
+    fclose(file);
+    t_graph g1 = importGraphFromFileWithScanf(path);
+    t_graph g2 = importGraphFromFile(path);
+    int result = (g1.size == 3 && isSameGraph(g1, g2)) ? 0 : 1;
+    freeGraph(&g1);
+    freeGraph(&g2);
+    remove(path);
+    return result;
+}
+
+// Test import par projection mémoire : mêmes graphes que l'import en flux
+static int test_read_mapped_file(void) {
+    t_graph g1 = importGraphFromFile("../data/exemple4_2check.txt");
+    t_graph g2 = importGraphFromMappedFile("../data/exemple4_2check.txt");
+    int result = (g1.size > 0 && isSameGraph(g1, g2)) ? 0 : 1;
+    freeGraph(&g1);
+    freeGraph(&g2);
+    return result;
+}
+
+// Test import "projeté" d'une FIFO : lue en flux sur le descripteur déjà ouvert
+static int test_read_mapped_fifo(void) {
+    const char *path = "test_mapped_fifo";
+    remove(path);
+    if (mkfifo(path, 0600) < 0) return 1;
+    pid_t pid = fork();
+    if (pid < 0) { remove(path); return 1; }
+    if (pid == 0) {
+        // Écrivain : un seul passage, le contenu est perdu si la FIFO est rouverte
+        FILE *file = fopen(path, "w");
+        if (file == NULL) _exit(1);
+        fprintf(file, "3\n1 2 0.5\n1 3 0.5\n2 1 1\n3 3 1\n");
+        fclose(file);
+        _exit(0);
+    }
+    t_graph g = importGraphFromMappedFile(path);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    remove(path);
+    int result = (g.size == 3 && WIFEXITED(status) && WEXITSTATUS(status) == 0 &&
+                  g.values[0].head != NULL && g.values[2].head != NULL) ? 0 : 1;
+    freeGraph(&g);
+    return result;
+}
+
+// Test import par projection mémoire d'un fichier inexistant ou vide
+static int test_read_mapped_file_invalid(void) {
+    t_graph g = importGraphFromMappedFile("fichier_inexistant.txt");
+    if (g.size != 0) { freeGraph(&g); return 1; }
+    const char *path = "test_mapped_empty.txt";
+    FILE *file = fopen(path, "w");
+    if (file == NULL) return 1;
+    fclose(file);
+    g = importGraphFromMappedFile(path);
+    remove(path);
+    int result = (g.size == 0) ? 0 : 1;
+    freeGraph(&g);
+    return result;
+}
+
 // Tests pour les graphs de markov
 static int test_markov_valid(void) {
     t_graph g = importGraphFromFile("../data/exemple1.txt");
@@ -565,6 +703,1588 @@ int test_tarjan_imported_graph_example3() {
     return result;
 }
 
+// Tests pour csr_graph.c
+// Vérifie qu'un graphe CSR a les mêmes arêtes, dans le même ordre, que le graphe d'origine
+static int csrGraphMatchesGraph(t_csr_graph csr, t_graph g) {
+    if (csr.size != g.size) return 0;
+    for (int i = 0; i < g.size; i++) {
+        int e = csr.offsets[i];
+        t_cell *curr = g.values[i].head;
+        while (curr != NULL) {
+            if (e >= csr.offsets[i + 1]) return 0;
+            if (csr.targets[e] != curr->vertex || csr.weights[e] != curr->weight) return 0;
+            e++;
+            curr = curr->next;
+        }
+        if (e != csr.offsets[i + 1]) return 0;
+    }
+    return 1;
+}
+
+// Vérifie que deux partitions contiennent les mêmes classes dans le même ordre
+static int samePartitions(t_partition *a, t_partition *b) {
+    if (a == NULL || b == NULL || a->class_number != b->class_number) return 0;
+    t_class *ca = a->classes, *cb = b->classes;
+    while (ca != NULL && cb != NULL) {
+        if (ca->id != cb->id || ca->vertex_number != cb->vertex_number) return 0;
+        t_vertex *va = ca->vertices, *vb = cb->vertices;
+        while (va != NULL && vb != NULL) {
+            if (va->value != vb->value) return 0;
+            va = va->next;
+            vb = vb->next;
+        }
+        if (va != NULL || vb != NULL) return 0;
+        ca = ca->next;
+        cb = cb->next;
+    }
+    return ca == NULL && cb == NULL;
+}
+
+static int test_csr_from_graph(void) {
+    t_graph g = createGraph(3);
+    addEdge(&g, 1, 2, 0.5);
+    addEdge(&g, 1, 3, 0.5);
+    addEdge(&g, 3, 1, 1.0);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    int result = (csr.edge_count == 3 && getCsrOutDegree(csr, 1) == 2 &&
+                  getCsrOutDegree(csr, 2) == 0 && csrGraphMatchesGraph(csr, g)) ? 0 : 1;
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Test import direct (avec arêtes en double) : même contenu que importGraphFromFile
+static int test_csr_import_matches_graph(void) {
+    t_graph g = importGraphFromFile("../data/exemple4_2check.txt");
+    t_csr_graph csr = importCsrGraphFromFile("../data/exemple4_2check.txt");
+    int result = (g.size > 0 && csrGraphMatchesGraph(csr, g)) ? 0 : 1;
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+static int test_csr_import_nonexistent(void) {
+    t_csr_graph csr = importCsrGraphFromFile("fichier_inexistant.txt");
+    return (isEmptyCsrGraph(csr) && csr.size == 0) ? 0 : 1;
+}
+
+// Test graphe inverse : chaque arête u -> v de poids w donne v -> u, sources croissantes
+static int test_csr_transpose(void) {
+    t_csr_graph csr = importCsrGraphFromFile("../data/exemple4_2check.txt");
+    t_csr_graph reverse = transposeCsrGraph(csr);
+    int result = (!isEmptyCsrGraph(reverse) && reverse.size == csr.size && reverse.edge_count == csr.edge_count) ? 0 : 1;
+    for (int v = 0; v < reverse.size && result == 0; v++) {
+        for (int e = reverse.offsets[v]; e < reverse.offsets[v + 1]; e++) {
+            int u = reverse.targets[e] - 1, found = 0;
+            if (e > reverse.offsets[v] && reverse.targets[e - 1] > reverse.targets[e]) result = 1;
+            for (int f = csr.offsets[u]; f < csr.offsets[u + 1]; f++)
+                found |= (csr.targets[f] == v + 1 && csr.weights[f] == reverse.weights[e]);
+            if (!found) result = 1;
+        }
+    }
+    freeCsrGraph(&reverse);
+    freeCsrGraph(&csr);
+    return result;
+}
+
+static int test_tarjan_csr_same_partition(void) {
+    t_graph g = importGraphFromFile("../data/exemple_valid_step3.txt");
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_partition *p1 = tarjan(g);
+    t_partition *p2 = tarjanCsr(csr);
+    int result = samePartitions(p1, p2) ? 0 : 1;
+    freePartition(p1);
+    freePartition(p2);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Test Tarjan itératif : même partition que la version récursive sur tous les exemples
+static int test_tarjan_iterative_same_partition(void) {
+    const char *paths[] = { "../data/exemple1.txt", "../data/exemple2.txt", "../data/exemple3.txt",
+                            "../data/exemple_hasse1.txt", "../data/exemple_scc1.txt",
+                            "../data/exemple_valid_step3.txt", "../data/exemple4_2check.txt" };
+    int result = 0;
+    for (int p = 0; p < (int)(sizeof paths / sizeof paths[0]); p++) {
+        t_graph g = importGraphFromFile(paths[p]);
+        if (g.size == 0) return 1;
+        t_partition *iterative = tarjan(g);
+        t_partition *recursive = tarjanRecursive(g);
+        if (!samePartitions(iterative, recursive)) result = 1;
+        freePartition(iterative);
+        freePartition(recursive);
+        freeGraph(&g);
+    }
+    return result;
+}
+
+// Test Tarjan itératif sur une chaîne de naissance et de mort d'un million d'états
+static int test_tarjan_iterative_long_chain(void) {
+    const int size = 1000000;
+    t_graph g = createArenaGraph(size);
+    for (int v = 1; v <= size; v++) {
+        addEdge(&g, v, v < size ? v + 1 : v, 0.5);
+        addEdge(&g, v, v > 1 ? v - 1 : v, 0.5);
+    }
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_partition *p1 = tarjan(g);
+    t_partition *p2 = tarjanCsr(csr);
+    int result = (p1 != NULL && p1->class_number == 1 && p1->classes->vertex_number == size &&
+                  samePartitions(p1, p2)) ? 0 : 1;
+    freePartition(p1);
+    freePartition(p2);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+
+    // Chaîne sans retour : une classe par état, la dernière fermée en premier
+    g = createArenaGraph(size);
+    for (int v = 1; v < size; v++) addEdge(&g, v, v + 1, 1.0);
+    p1 = tarjan(g);
+    if (p1 == NULL || p1->class_number != size) result = 1;
+    freePartition(p1);
+    freeGraph(&g);
+    return result;
+}
+
+static int test_matrix_from_csr_graph(void) {
+    t_graph g = importGraphFromFile("../data/exemple4_2check.txt");
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_matrix m1, m2;
+    int result = 1;
+    if (createMatrixFromGraph(g, &m1) == 1) {
+        if (createMatrixFromCsrGraph(csr, &m2) == 1) {
+            result = (diffMatrices(m1, m2) == 0.0) ? 0 : 1;
+            freeMatrix(&m2);
+        }
+        freeMatrix(&m1);
+    }
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Tests pour graph_loader.c
+// Test import parallèle : mêmes graphes que l'import séquentiel, quel que soit le nombre de threads
+static int test_read_file_parallel(void) {
+    const char *path = "test_parallel_graph.txt";
+    FILE *file = fopen(path, "w");
+    if (file == NULL) return 1;
+    // Assez d'arêtes pour découper le fichier en plusieurs morceaux, plus une arête invalide
+    fprintf(file, "500\n");
+    for (int i = 0; i < 40000; i++) {
+        fprintf(file, "%d %d %.6f\n", 1 + (i * 7) % 500, 1 + (i * 13) % 500, 0.001 * (i % 1000));
+    }
+    fprintf(file, "501 1 0.5\n");
+    fclose(file);
+
+    t_graph reference = importGraphFromFile(path);
+    int result = (reference.size == 500) ? 0 : 1;
+    for (int threads = 1; threads <= 4 && result == 0; threads++) {
+        t_graph g = importGraphFromFileParallel(path, threads);
+        t_csr_graph csr = importCsrGraphFromFileParallel(path, threads);
+        if (!isSameGraph(reference, g) || !csrGraphMatchesGraph(csr, reference)) result = 1;
+        freeCsrGraph(&csr);
+        freeGraph(&g);
+    }
+    freeGraph(&reference);
+    remove(path);
+    return result;
+}
+
+// Test import parallèle d'un fichier mal formé : repli sur le chargeur séquentiel
+static int test_read_file_parallel_fallback(void) {
+    t_graph g1 = importGraphFromFile("../data/exemple4_2check.txt");
+    t_graph g2 = importGraphFromFileParallel("../data/exemple4_2check.txt", 4);
+    int result = (g1.size > 0 && isSameGraph(g1, g2)) ? 0 : 1;
+    freeGraph(&g1);
+    freeGraph(&g2);
+
+    const char *path = "test_parallel_formats.txt";
+    FILE *file = fopen(path, "w");
+    if (file == NULL) return 1;
+    fprintf(file, "3\n1 2\n0.5\n1 3 0.5\n3 3 7abc\n3 1 0.5\n");
+    fclose(file);
+    g1 = importGraphFromFile(path);
+    g2 = importGraphFromFileParallel(path, 2);
+    if (g1.size != 3 || !isSameGraph(g1, g2)) result = 1;
+    freeGraph(&g1);
+    freeGraph(&g2);
+    remove(path);
+    return result;
+}
+
+// Tests pour graph_binary.c
+// Test aller-retour texte -> binaire -> graphe sur tous les exemples
+static int test_binary_round_trip(void) {
+    const char *paths[] = {
+        "../data/exemple1.txt", "../data/exemple3.txt", "../data/exemple4_2check.txt", "../data/exemple_valid_step3.txt"
+    };
+    const char *binary_path = "test_graph.bin";
+    for (int i = 0; i < (int)(sizeof(paths)/sizeof(paths[0])); i++) {
+        t_graph g1 = importGraphFromFile(paths[i]);
+        int same = (g1.size > 0 && exportGraphToBinaryFile(g1, binary_path) == 1);
+        if (same) {
+            t_graph g2 = importGraphFromBinaryFile(binary_path);
+            t_csr_graph csr = importCsrGraphFromBinaryFile(binary_path);
+            same = isSameGraph(g1, g2) && csrGraphMatchesGraph(csr, g1);
+            freeCsrGraph(&csr);
+            freeGraph(&g2);
+        }
+        freeGraph(&g1);
+        remove(binary_path);
+        if (!same) return 1;
+    }
+    return 0;
+}
+
+// Test conversion d'un fichier texte puis chargement CSR sans copie
+static int test_binary_convert(void) {
+    const char *binary_path = "test_convert.bin";
+    if (convertGraphFileToBinary("../data/exemple_valid_step3.txt", binary_path) != 1) return 1;
+    t_csr_graph expected = importCsrGraphFromFile("../data/exemple_valid_step3.txt");
+    t_csr_graph csr = importCsrGraphFromBinaryFile(binary_path);
+    int result = (!isEmptyCsrGraph(csr) && csr.size == expected.size && csr.edge_count == expected.edge_count &&
+                  memcmp(csr.offsets, expected.offsets, ((size_t)csr.size + 1) * sizeof *csr.offsets) == 0 &&
+                  memcmp(csr.targets, expected.targets, (size_t)csr.edge_count * sizeof *csr.targets) == 0 &&
+                  memcmp(csr.weights, expected.weights, (size_t)csr.edge_count * sizeof *csr.weights) == 0) ? 0 : 1;
+    freeCsrGraph(&csr);
+    freeCsrGraph(&expected);
+    remove(binary_path);
+    return result;
+}
+
+// Test chargement d'un fichier qui n'est pas au format binaire, ou tronqué
+static int test_binary_invalid(void) {
+    t_graph g = importGraphFromBinaryFile("../data/exemple1.txt");
+    int result = (g.size == 0) ? 0 : 1;
+    freeGraph(&g);
+
+    const char *binary_path = "test_truncated.bin";
+    if (convertGraphFileToBinary("../data/exemple1.txt", binary_path) != 1) return 1;
+    FILE *file = fopen(binary_path, "r+b");
+    if (file == NULL) return 1;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    if (truncate(binary_path, size - 1) != 0) result = 1;
+    t_csr_graph csr = importCsrGraphFromBinaryFile(binary_path);
+    if (!isEmptyCsrGraph(csr)) result = 1;
+    freeCsrGraph(&csr);
+    remove(binary_path);
+    return result;
+}
+
+// Tests pour matrix.c
+// Test stockage contigu : lignes alignées dans un seul bloc, accès data[i][j] conservé
+static int test_matrix_contiguous_storage(void) {
+    t_matrix m = createMatrix(3, 5);
+    if (!isValidMatrix(m)) return 1;
+    int result = (m.stride >= m.cols && ((size_t)m.values % MATRIX_ALIGNMENT) == 0) ? 0 : 1;
+    for (int i = 0; i < m.rows; i++) {
+        if (m.data[i] != getMatrixRow(m, i) || ((size_t)m.data[i] % MATRIX_ALIGNMENT) != 0) result = 1;
+        for (int j = 0; j < m.cols; j++) {
+            if (m.data[i][j] != 0.0) result = 1;
+        }
+    }
+    setMatrixValue(&m, 2, 4, 1.5);
+    if (m.values[2 * m.stride + 4] != 1.5) result = 1;
+    freeMatrix(&m);
+    return (result == 0 && isEmptyMatrix(m)) ? 0 : 1;
+}
+
+// Test copie, remplissage et produit sur le stockage contigu
+static int test_matrix_set_data_multiply(void) {
+    double values_a[] = { 1, 2, 3, 4, 5, 6 };
+    double values_b[] = { 7, 8, 9, 10, 11, 12 };
+    double expected[] = { 58, 64, 139, 154 };
+    t_matrix a = createMatrix(2, 3), b = createMatrix(3, 2), copy = createMatrix(2, 3), c;
+    int result = (setMatrixData(&a, values_a, 6) == 1 && setMatrixData(&b, values_b, 6) == 1 &&
+                  setMatrixData(&a, values_a, 5) == -1 && copyMatrix(a, &copy) == 1 &&
+                  diffMatrices(a, copy) == 0.0 && multiplyMatrices(copy, b, &c) == 1) ? 0 : 1;
+    if (result == 0) {
+        for (int i = 0; i < 4; i++) {
+            if (c.data[i / 2][i % 2] != expected[i]) result = 1;
+        }
+        freeMatrix(&c);
+    }
+    freeMatrix(&a);
+    freeMatrix(&b);
+    freeMatrix(&copy);
+    return result;
+}
+
+// Test produit par blocs : tous les noyaux donnent exactement le résultat de la triple boucle
+static int test_matrix_multiply_kernels(void) {
+    const int rows = 37, inner = 300, cols = 301;
+    t_matrix a = createMatrix(rows, inner), b = createMatrix(inner, cols), reference = createMatrix(rows, cols);
+    if (!isValidMatrix(a) || !isValidMatrix(b) || !isValidMatrix(reference)) return 1;
+    for (int i = 0; i < rows; i++)
+        for (int k = 0; k < inner; k++) a.data[i][k] = (double)((i * 31 + k * 17) % 97) / 97.0;
+    for (int k = 0; k < inner; k++)
+        for (int j = 0; j < cols; j++) b.data[k][j] = (double)((k * 13 + j * 7) % 89) / 89.0;
+    for (int i = 0; i < rows; i++)
+        for (int j = 0; j < cols; j++)
+            for (int k = 0; k < inner; k++) reference.data[i][j] += a.data[i][k] * b.data[k][j];
+
+    int result = 0;
+    t_matrix_kernel kernels[] = { MATRIX_KERNEL_SCALAR, MATRIX_KERNEL_AVX2, MATRIX_KERNEL_AVX512 };
+    for (int t = 0; t < 3; t++) {
+        if (selectMatrixKernel(kernels[t]) < 0) continue;
+        t_matrix c;
+        if (multiplyMatrices(a, b, &c) < 0 || diffMatrices(c, reference) != 0.0) result = 1;
+        freeMatrix(&c);
+    }
+    selectMatrixKernel(MATRIX_KERNEL_AUTO);
+    freeMatrix(&a);
+    freeMatrix(&b);
+    freeMatrix(&reference);
+    return result;
+}
+
+// Test exponentiation rapide : mêmes valeurs que les produits successifs
+static int test_matrix_power_squaring(void) {
+    t_graph g = importGraphFromFile("../data/exemple_valid_step3.txt");
+    t_matrix m, p, expected, next;
+    if (g.size == 0 || createMatrixFromGraph(g, &m) < 0) { freeGraph(&g); return 1; }
+    freeGraph(&g);
+
+    int result = 0;
+    expected = createMatrix(m.rows, m.cols);
+    for (int i = 0; i < m.rows; i++) expected.data[i][i] = 1.0;
+    for (int n = 0; n <= 2000 && result == 0; n++) {
+        // expected = M^n par produits successifs
+        if (n <= 21 || n == 2000) {
+            if (powerMatrix(m, n, &p) < 0) { result = 1; break; }
+            if (diffMatrices(p, expected) > 1e-9) result = 1;
+            freeMatrix(&p);
+        }
+        multiplyMatrices(expected, m, &next);
+        freeMatrix(&expected);
+        expected = next;
+    }
+    freeMatrix(&expected);
+    freeMatrix(&m);
+    return result;
+}
+
+// Test produit dans une matrice déjà allouée
+static int test_matrix_multiply_into(void) {
+    double values[] = { 0.5, 0.5, 0.25, 0.75 };
+    t_matrix a = createMatrix(2, 2), c = createMatrix(2, 2), wrong = createMatrix(3, 2), expected;
+    setMatrixData(&a, values, 4);
+    multiplyMatrices(a, a, &expected);
+    int result = (multiplyMatricesInto(a, a, c) == 1 && diffMatrices(c, expected) == 0.0 &&
+                  multiplyMatricesInto(a, a, a) == -1 && multiplyMatricesInto(a, a, wrong) == -1) ? 0 : 1;
+    freeMatrix(&a);
+    freeMatrix(&c);
+    freeMatrix(&wrong);
+    freeMatrix(&expected);
+    return result;
+}
+
+// Test convergence incrémentale : même exposant que la recherche puissance par puissance
+static int test_matrix_converged_power(void) {
+    t_graph g = importGraphFromFile("../data/exemple1.txt");
+    t_matrix m, limit, p, prev;
+    if (g.size == 0 || createMatrixFromGraph(g, &m) < 0) { freeGraph(&g); return 1; }
+    freeGraph(&g);
+
+    // Référence : M^n recalculée à chaque n
+    int expected = -1;
+    powerMatrix(m, 1, &prev);
+    for (int n = 2; n <= 200 && expected < 0; n++) {
+        powerMatrix(m, n, &p);
+        if (diffMatrices(prev, p) < 0.01) expected = n;
+        freeMatrix(&prev);
+        prev = p;
+    }
+
+    int n = computeConvergedMatrixPower(m, 0.01, &limit, 200);
+    int result = (expected > 0 && n == expected && diffMatrices(limit, prev) < 1e-9) ? 0 : 1;
+    freeMatrix(&prev);
+    if (n > 0) freeMatrix(&limit);
+
+    // Doublement : exposant puissance de 2, M^n correcte
+    n = computeConvergedMatrixPowerWithMode(m, 0.01, &limit, 200, CONVERGENCE_DOUBLING);
+    if (n < 2 || (n & (n - 1)) != 0) {
+        result = 1;
+    } else {
+        powerMatrix(m, n, &p);
+        if (diffMatrices(limit, p) > 1e-9) result = 1;
+        freeMatrix(&p);
+        freeMatrix(&limit);
+    }
+
+    // Pas de convergence possible avec maxIter = 1
+    if (computeConvergedMatrixPower(m, 0.01, &limit, 1) != -1) result = 1;
+    freeMatrix(&m);
+    return result;
+}
+
+// Tests pour propagation.c
+// Compte les pas reçus et s'arrête après le pas demandé
+static int countStepsUntil(int step, const double *distribution, int size, void *user_data) {
+    (void)distribution;
+    (void)size;
+    int *limit = (int *)user_data;
+    return step >= *limit;
+}
+
+// Test propagation sur le graphe et sur le CSR : même distribution que le calcul matriciel
+static int test_propagation_matches_matrix(void) {
+    t_graph g = importGraphFromFile("../data/exemple_valid_step3.txt");
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_matrix m, initial, expected;
+    if (g.size == 0 || createMatrixFromGraph(g, &m) < 0) { freeGraph(&g); freeCsrGraph(&csr); return 1; }
+    initial = createMatrix(1, g.size);
+    initial.data[0][0] = 1.0;
+    computeDistributionAfterNSteps(m, initial, 25, &expected);
+
+    double *on_graph = calloc((size_t)g.size, sizeof *on_graph);
+    double *on_csr = calloc((size_t)g.size, sizeof *on_csr);
+    on_graph[0] = on_csr[0] = 1.0;
+    int result = (propagateDistributionOnGraph(g, on_graph, 25, NULL, NULL) == 25 &&
+                  propagateDistributionOnCsrGraph(csr, on_csr, 25, NULL, NULL) == 25) ? 0 : 1;
+    for (int i = 0; i < g.size; i++) {
+        if (fabs(on_graph[i] - expected.data[0][i]) > 1e-12 || fabs(on_csr[i] - expected.data[0][i]) > 1e-12) result = 1;
+    }
+
+    free(on_graph);
+    free(on_csr);
+    freeMatrix(&m);
+    freeMatrix(&initial);
+    freeMatrix(&expected);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Test arêtes en double : propagation, matrice dense et matrice creuse additionnent les poids
+static int test_propagation_duplicate_edges(void) {
+    t_graph g = createGraph(3);
+    addEdge(&g, 1, 2, 0.25);
+    addEdge(&g, 1, 3, 0.5);
+    addEdge(&g, 1, 2, 0.25);
+    addEdge(&g, 2, 1, 1.0);
+    addEdge(&g, 3, 1, 0.5);
+    addEdge(&g, 3, 3, 0.5);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_matrix m, initial, expected;
+    t_sparse_matrix sparse;
+    if (createMatrixFromGraph(g, &m) < 0) { freeCsrGraph(&csr); freeGraph(&g); return 1; }
+    if (createSparseMatrixFromCsrGraph(csr, &sparse) < 0) { freeMatrix(&m); freeCsrGraph(&csr); freeGraph(&g); return 1; }
+    int result = (m.data[0][1] == 0.5 && sparse.nnz == 5 && sparse.values[0] == 0.5) ? 0 : 1;
+    initial = createMatrix(1, 3);
+    initial.data[0][0] = 1.0;
+    computeDistributionAfterNSteps(m, initial, 9, &expected);
+
+    double on_graph[3] = { 1.0, 0.0, 0.0 }, on_csr[3] = { 1.0, 0.0, 0.0 };
+    double on_sparse[3] = { 1.0, 0.0, 0.0 }, next[3];
+    if (propagateDistributionOnGraph(g, on_graph, 9, NULL, NULL) != 9 ||
+        propagateDistributionOnCsrGraph(csr, on_csr, 9, NULL, NULL) != 9) result = 1;
+    for (int s = 0; s < 9; s++) {
+        multiplyVectorSparseMatrix(on_sparse, sparse, next);
+        memcpy(on_sparse, next, sizeof next);
+    }
+    for (int i = 0; i < 3; i++) {
+        if (fabs(on_graph[i] - expected.data[0][i]) > 1e-12 || fabs(on_csr[i] - expected.data[0][i]) > 1e-12 ||
+            fabs(on_sparse[i] - expected.data[0][i]) > 1e-12) result = 1;
+    }
+
+    freeSparseMatrix(&sparse);
+    freeMatrix(&m);
+    freeMatrix(&initial);
+    freeMatrix(&expected);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Test série temporelle : une ligne par pas, arrêt anticipé par le callback
+static int test_propagation_time_series(void) {
+    t_graph g = importGraphFromFile("../data/exemple1.txt");
+    if (g.size == 0) return 1;
+    double *distribution = calloc((size_t)g.size, sizeof *distribution);
+    distribution[0] = 1.0;
+
+    const char *path = "test_time_series.csv";
+    FILE *file = fopen(path, "w");
+    int result = (file != NULL && propagateDistributionOnGraph(g, distribution, 7, writeDistributionStep, file) == 7) ? 0 : 1;
+    if (file != NULL) fclose(file);
+
+    int lines = 0;
+    char line[1024];
+    file = fopen(path, "r");
+    while (file != NULL && fgets(line, sizeof line, file) != NULL) lines++;
+    if (file != NULL) fclose(file);
+    remove(path);
+    if (lines != 7) result = 1;
+
+    int limit = 3;
+    if (propagateDistributionOnGraph(g, distribution, 10, countStepsUntil, &limit) != 3) result = 1;
+    if (propagateDistributionOnGraph(g, distribution, -1, NULL, NULL) != -1) result = 1;
+    free(distribution);
+    freeGraph(&g);
+    return result;
+}
+
+// Tests pour sparse_matrix.c
+// Test matrice creuse : mêmes coefficients que la matrice dense, doublons compris
+static int test_sparse_matrix_from_graph(void) {
+    const char *paths[] = { "../data/exemple1.txt", "../data/exemple4_2check.txt", "../data/exemple_valid_step3.txt" };
+    int result = 0;
+    for (int p = 0; p < 3; p++) {
+        t_graph g = importGraphFromFile(paths[p]);
+        t_matrix dense, expanded;
+        t_sparse_matrix sparse, transposed, back;
+        if (g.size == 0 || createMatrixFromGraph(g, &dense) < 0) { freeGraph(&g); return 1; }
+        if (createSparseMatrixFromGraph(g, &sparse) < 0) { freeMatrix(&dense); freeGraph(&g); return 1; }
+        if (sparseToDenseMatrix(sparse, &expanded) < 0 || diffMatrices(dense, expanded) != 0.0) result = 1;
+        for (int i = 0; i < sparse.rows; i++) {
+            for (int e = sparse.row_offsets[i] + 1; e < sparse.row_offsets[i + 1]; e++) {
+                if (sparse.col_indices[e - 1] >= sparse.col_indices[e]) result = 1;
+            }
+        }
+        // Transposer deux fois redonne la même matrice
+        if (transposeSparseMatrix(sparse, &transposed) < 0 || transposeSparseMatrix(transposed, &back) < 0 ||
+            back.nnz != sparse.nnz ||
+            memcmp(back.col_indices, sparse.col_indices, (size_t)sparse.nnz * sizeof(int)) != 0 ||
+            memcmp(back.values, sparse.values, (size_t)sparse.nnz * sizeof(double)) != 0) {
+            result = 1;
+        }
+        freeSparseMatrix(&back);
+        freeSparseMatrix(&transposed);
+        freeMatrix(&expanded);
+        freeSparseMatrix(&sparse);
+        freeMatrix(&dense);
+        freeGraph(&g);
+    }
+    return result;
+}
+
+// Test produits creux : identiques (à l'arrondi près) aux produits denses
+static int test_sparse_matrix_products(void) {
+    t_graph g = importGraphFromFile("../data/exemple_valid_step3.txt");
+    t_matrix dense, expected, product, expanded;
+    t_sparse_matrix sparse, square;
+    if (g.size == 0 || createMatrixFromGraph(g, &dense) < 0) { freeGraph(&g); return 1; }
+    if (createSparseMatrixFromGraph(g, &sparse) < 0) { freeMatrix(&dense); freeGraph(&g); return 1; }
+    multiplyMatrices(dense, dense, &expected);
+
+    int result = 0;
+    if (multiplySparseDenseMatrices(sparse, dense, &product) < 0) return 1;
+    if (diffMatrices(product, expected) > 1e-12) result = 1;
+    freeMatrix(&product);
+    if (multiplySparseMatrices(sparse, sparse, &square) < 0 || sparseToDenseMatrix(square, &expanded) < 0) return 1;
+    if (diffMatrices(expanded, expected) > 1e-12) result = 1;
+    freeMatrix(&expanded);
+    freeSparseMatrix(&square);
+
+    // y = A x et y = x A comparés au calcul dense
+    double *x = malloc((size_t)g.size * sizeof *x);
+    double *y = malloc((size_t)g.size * sizeof *y);
+    double *z = malloc((size_t)g.size * sizeof *z);
+    for (int i = 0; i < g.size; i++) x[i] = 1.0 + i;
+    multiplySparseMatrixVector(sparse, x, y);
+    multiplyVectorSparseMatrix(x, sparse, z);
+    for (int i = 0; i < g.size; i++) {
+        double row = 0.0, col = 0.0;
+        for (int k = 0; k < g.size; k++) {
+            row += dense.data[i][k] * x[k];
+            col += x[k] * dense.data[k][i];
+        }
+        if (fabs(row - y[i]) > 1e-12 || fabs(col - z[i]) > 1e-12) result = 1;
+    }
+    if (multiplySparseMatrixVector(sparse, x, x) != -1) result = 1;
+
+    free(x);
+    free(y);
+    free(z);
+    freeMatrix(&expected);
+    freeSparseMatrix(&sparse);
+    freeMatrix(&dense);
+    freeGraph(&g);
+    return result;
+}
+
+// Test sous-matrice et distribution creuses : mêmes résultats que la version dense
+static int test_sparse_matrix_submatrix_distribution(void) {
+    t_graph g = importGraphFromFile("../data/exemple_valid_step3.txt");
+    t_matrix dense, initial, expected, actual;
+    t_sparse_matrix sparse;
+    if (g.size == 0 || createMatrixFromGraph(g, &dense) < 0) { freeGraph(&g); return 1; }
+    if (createSparseMatrixFromGraph(g, &sparse) < 0) { freeMatrix(&dense); freeGraph(&g); return 1; }
+
+    int result = 0;
+    t_partition *partition = tarjan(g);
+    for (t_class *c = partition->classes; c != NULL; c = c->next) {
+        t_matrix sub = buildSubMatrix(dense, *partition, c->id), sub_expanded;
+        t_sparse_matrix sparse_sub = buildSparseSubMatrix(sparse, *partition, c->id);
+        if (isEmptySparseMatrix(sparse_sub) || sparseToDenseMatrix(sparse_sub, &sub_expanded) < 0) {
+            result = 1;
+        } else {
+            if (diffMatrices(sub, sub_expanded) != 0.0) result = 1;
+            freeMatrix(&sub_expanded);
+        }
+        freeSparseMatrix(&sparse_sub);
+        freeMatrix(&sub);
+    }
+    if (!isEmptySparseMatrix(buildSparseSubMatrix(sparse, *partition, -1))) result = 1;
+    freePartition(partition);
+
+    initial = createMatrix(1, g.size);
+    initial.data[0][0] = 1.0;
+    computeDistributionAfterNSteps(dense, initial, 25, &expected);
+    if (computeSparseDistributionAfterNSteps(sparse, initial, 25, &actual) < 0) {
+        result = 1;
+    } else {
+        if (diffMatrices(expected, actual) > 1e-12) result = 1;
+        freeMatrix(&actual);
+    }
+    if (computeSparseDistributionAfterNSteps(sparse, initial, -1, &actual) != -1) result = 1;
+
+    freeMatrix(&initial);
+    freeMatrix(&expected);
+    freeSparseMatrix(&sparse);
+    freeMatrix(&dense);
+    freeGraph(&g);
+    return result;
+}
+
+// Tests pour stationary.c
+// Test classe apériodique : les trois méthodes donnent la limite de M^n
+static int test_stationary_matches_converged_power(void) {
+    t_graph g = importGraphFromFile("../data/exemple1.txt");
+    t_matrix m, limit;
+    t_sparse_matrix sparse;
+    if (g.size == 0 || createMatrixFromGraph(g, &m) < 0) { freeGraph(&g); return 1; }
+    createSparseMatrixFromMatrix(m, &sparse);
+    int result = computeConvergedMatrixPower(m, 1e-12, &limit, 100000) > 0 ? 0 : 1;
+
+    const t_stationary_method methods[] = { STATIONARY_POWER, STATIONARY_LAZY, STATIONARY_CESARO };
+    double *pi = malloc((size_t)g.size * sizeof *pi);
+    for (int k = 0; k < 3 && result == 0; k++) {
+        double tolerance = (methods[k] == STATIONARY_CESARO) ? 1e-4 : 1e-12;
+        if (computeStationaryDistribution(sparse, methods[k], tolerance, STATIONARY_MAX_ITERATIONS, pi) < 0) result = 1;
+        for (int j = 0; j < g.size; j++) {
+            if (fabs(pi[j] - limit.data[0][j]) > ((methods[k] == STATIONARY_CESARO) ? 1e-3 : 1e-9)) result = 1;
+        }
+        if (stationaryResidual(sparse, pi) >= tolerance) result = 1;
+    }
+
+    free(pi);
+    if (isValidMatrix(limit)) freeMatrix(&limit);
+    freeSparseMatrix(&sparse);
+    freeMatrix(&m);
+    freeGraph(&g);
+    return result;
+}
+
+// Test classe de période 2 (1 <-> 2 <-> 3) : POWER oscille, LAZY et CESARO convergent
+static int test_stationary_periodic_class(void) {
+    t_graph g = createArenaGraph(3);
+    addEdge(&g, 1, 2, 1.0);
+    addEdge(&g, 2, 1, 0.5);
+    addEdge(&g, 2, 3, 0.5);
+    addEdge(&g, 3, 2, 1.0);
+    t_sparse_matrix sparse;
+    if (createSparseMatrixFromGraph(g, &sparse) < 0) { freeGraph(&g); return 1; }
+
+    const double expected[3] = { 0.25, 0.5, 0.25 };
+    double pi[3];
+    int result = 0;
+    if (computeStationaryDistribution(sparse, STATIONARY_POWER, 1e-12, 1000, pi) != -1) result = 1;
+    if (computeStationaryDistribution(sparse, STATIONARY_LAZY, 1e-12, STATIONARY_MAX_ITERATIONS, pi) < 0) result = 1;
+    for (int j = 0; j < 3; j++) if (fabs(pi[j] - expected[j]) > 1e-9) result = 1;
+    if (computeStationaryDistribution(sparse, STATIONARY_CESARO, 1e-4, STATIONARY_MAX_ITERATIONS, pi) < 0) result = 1;
+    for (int j = 0; j < 3; j++) if (fabs(pi[j] - expected[j]) > 1e-3) result = 1;
+    if (computeStationaryDistribution(sparse, STATIONARY_LAZY, 0.0, 10, pi) != -1) result = 1;
+
+    freeSparseMatrix(&sparse);
+    freeGraph(&g);
+    return result;
+}
+
+// Test solveurs directs GTH et LU : valeurs exactes de exemple1 et classe périodique
+static int test_stationary_direct_solvers(void) {
+    t_graph g = importGraphFromFile("../data/exemple1.txt");
+    t_matrix m;
+    if (g.size != 4 || createMatrixFromGraph(g, &m) < 0) { freeGraph(&g); return 1; }
+    // pi = pi P résolu à la main : pi1 = 0.625, pi2 = 0.25, pi3 = 0.09375, pi4 = 0.03125
+    const double expected[4] = { 0.625, 0.25, 0.09375, 0.03125 };
+    double gth[4], lu[4];
+    int result = (computeStationaryDistributionGTH(m, gth) == 1 && computeStationaryDistributionLU(m, lu) == 1) ? 0 : 1;
+    for (int j = 0; j < 4 && result == 0; j++) {
+        if (fabs(gth[j] - expected[j]) > 1e-15 || fabs(lu[j] - expected[j]) > 1e-14) result = 1;
+    }
+    freeMatrix(&m);
+    freeGraph(&g);
+
+    // Classe de période 2 : résolue directement sans itération
+    t_matrix cycle = createMatrix(3, 3);
+    cycle.data[0][1] = 1.0;
+    cycle.data[1][0] = 0.5;
+    cycle.data[1][2] = 0.5;
+    cycle.data[2][1] = 1.0;
+    double pi[3];
+    if (computeStationaryDistributionGTH(cycle, pi) != 1 || fabs(pi[0] - 0.25) > 1e-15 || fabs(pi[1] - 0.5) > 1e-15) result = 1;
+    if (computeStationaryDistributionLU(cycle, pi) != 1 || fabs(pi[0] - 0.25) > 1e-15 || fabs(pi[1] - 0.5) > 1e-15) result = 1;
+
+    // Classe réductible (état 3 absorbant) : erreur
+    cycle.data[2][1] = 0.0;
+    cycle.data[2][2] = 1.0;
+    if (computeStationaryDistributionGTH(cycle, pi) != -1) result = 1;
+    freeMatrix(&cycle);
+    return result;
+}
+
+// Test du choix du solveur et de la résolution par solveStationaryDistribution
+static int test_stationary_solver_dispatch(void) {
+    int result = 0;
+    if (chooseStationarySolver(10, 30) != STATIONARY_SOLVER_GTH) result = 1;
+    if (chooseStationarySolver(1000, 1000000) != STATIONARY_SOLVER_GTH) result = 1;
+    if (chooseStationarySolver(100000, 1000000) != STATIONARY_SOLVER_ITERATIVE) result = 1;
+    if (chooseStationarySolver(STATIONARY_DIRECT_MAX_SIZE + 1, 100000000) != STATIONARY_SOLVER_ITERATIVE) result = 1;
+
+    t_graph g = importGraphFromFile("../data/exemple1.txt");
+    t_sparse_matrix sparse;
+    if (g.size == 0 || createSparseMatrixFromGraph(g, &sparse) < 0) { freeGraph(&g); return 1; }
+    const t_stationary_solver solvers[] = { STATIONARY_SOLVER_AUTO, STATIONARY_SOLVER_GTH,
+                                            STATIONARY_SOLVER_LU, STATIONARY_SOLVER_ITERATIVE };
+    double pi[4];
+    for (int k = 0; k < 4; k++) {
+        if (solveStationaryDistribution(sparse, solvers[k], 1e-12, pi) != 1 || fabs(pi[0] - 0.625) > 1e-9) result = 1;
+    }
+    freeSparseMatrix(&sparse);
+    freeGraph(&g);
+    return result;
+}
+
+// Test calcul parallèle des distributions stationnaires : résultats identiques quel que soit le nombre de threads
+static int test_stationary_parallel_classes(void) {
+    // 20 classes persistantes de tailles 2 à 21 (cycles avec boucles), plus un sommet transitoire
+    int size = 1;
+    for (int k = 2; k <= 21; k++) size += k;
+    t_graph g = createArenaGraph(size);
+    int first = 2;
+    for (int k = 2; k <= 21; k++) {
+        for (int v = 0; v < k; v++) {
+            addEdge(&g, first + v, first + (v + 1) % k, 0.7);
+            addEdge(&g, first + v, first + v, 0.3);
+        }
+        addEdge(&g, 1, first, 1.0 / 20);
+        first += k;
+    }
+    t_matrix m;
+    if (createMatrixFromGraph(g, &m) < 0) { freeGraph(&g); return 1; }
+    t_hasse_diagram hasse = createHasseDiagram(g);
+    t_partition part = *hasse.partition;
+
+    t_matrix *sequential = calloc((size_t)part.class_number, sizeof *sequential);
+    t_matrix *parallel = calloc((size_t)part.class_number, sizeof *parallel);
+    int result = (part.class_number == 21 &&
+                  computeStationaryDistributions(m, part, hasse, 1e-12, 1, sequential) == 1 &&
+                  computeStationaryDistributions(m, part, hasse, 1e-12, 4, parallel) == 1) ? 0 : 1;
+    int index = 0;
+    for (t_class *c = part.classes; c != NULL && result == 0; c = c->next, index++) {
+        double sum = 0.0;
+        for (int j = 0; j < c->vertex_number; j++) {
+            if (memcmp(&sequential[index].data[0][j], &parallel[index].data[0][j], sizeof(double)) != 0) result = 1;
+            sum += parallel[index].data[0][j];
+        }
+        // Cycle avec boucles : distribution uniforme sur la classe, nulle pour le sommet transitoire
+        double expected = isPersistantClass(hasse, c->id) ? 1.0 : 0.0;
+        if (fabs(sum - expected) > 1e-9) result = 1;
+        if (expected > 0.0 && fabs(parallel[index].data[0][0] - 1.0 / c->vertex_number) > 1e-9) result = 1;
+    }
+    for (int i = 0; i < part.class_number; i++) {
+        freeMatrix(&sequential[i]);
+        freeMatrix(&parallel[i]);
+    }
+    free(sequential);
+    free(parallel);
+    freeHasseDiagram(&hasse);
+    freeMatrix(&m);
+    freeGraph(&g);
+    return result;
+}
+
+// Tests pour scc.c
+// Vérifie que deux partitions d'un graphe de taille size ont les mêmes classes, quels que soient leurs ids
+static int sameComponents(t_partition *a, t_partition *b, int size) {
+    if (a == NULL || b == NULL || a->class_number != b->class_number) return 0;
+    int *class_a = calloc((size_t)size, sizeof(int));
+    int *class_b = calloc((size_t)size, sizeof(int));
+    int *match = calloc((size_t)a->class_number + 1, sizeof(int));
+    int result = class_a != NULL && class_b != NULL && match != NULL;
+    for (t_class *c = a->classes; c != NULL && result; c = c->next)
+        for (t_vertex *v = c->vertices; v != NULL; v = v->next) class_a[v->value - 1] = c->id;
+    for (t_class *c = b->classes; c != NULL && result; c = c->next)
+        for (t_vertex *v = c->vertices; v != NULL; v = v->next) class_b[v->value - 1] = c->id;
+    // Même nombre de classes et correspondance injective des ids : les classes sont les mêmes
+    for (int v = 0; v < size && result; v++) {
+        if (class_a[v] < 1 || class_a[v] > a->class_number || class_b[v] == 0) result = 0;
+        else if (match[class_a[v]] == 0) match[class_a[v]] = class_b[v];
+        else if (match[class_a[v]] != class_b[v]) result = 0;
+    }
+    for (int i = 1; i <= a->class_number && result; i++)
+        for (int j = i + 1; j <= a->class_number && result; j++)
+            if (match[i] != 0 && match[i] == match[j]) result = 0;
+    free(class_a);
+    free(class_b);
+    free(match);
+    return result;
+}
+
+// Graphe aléatoire : des cycles de taille moyenne reliés entre eux et des arêtes au hasard
+static t_graph createRandomSccGraph(int size, unsigned int seed) {
+    t_graph g = createArenaGraph(size);
+    unsigned int state = seed;
+    for (int v = 1; v <= size; v++) {
+        state = state * 1103515245u + 12345u;
+        int block = 1 + (int)((state >> 16) % 50);
+        if (v % block != 0 && v < size) addEdge(&g, v, v + 1, 0.5);
+        state = state * 1103515245u + 12345u;
+        int target = 1 + (int)((state >> 8) % (unsigned int)size);
+        addEdge(&g, v, target, 0.5);
+    }
+    return g;
+}
+
+// Test moteur parallèle : mêmes composantes que Tarjan, même partition pour 1 et 4 threads
+static int test_scc_parallel_same_components(void) {
+    const char *paths[] = { "../data/exemple1.txt", "../data/exemple2.txt", "../data/exemple3.txt",
+                            "../data/exemple_hasse1.txt", "../data/exemple_scc1.txt",
+                            "../data/exemple_valid_step3.txt", "../data/exemple4_2check.txt" };
+    int count = (int)(sizeof paths / sizeof paths[0]);
+    int result = 0;
+    for (int p = 0; p < count + 3 && result == 0; p++) {
+        t_graph g = p < count ? importGraphFromFile(paths[p])
+                              : createRandomSccGraph(p == count ? 500 : 30000, 17u + (unsigned int)p);
+        if (g.size == 0) return 1;
+        t_csr_graph csr = createCsrGraphFromGraph(g);
+        t_partition *reference = tarjanCsr(csr);
+        t_partition *single = parallelScc(csr, 1);
+        t_partition *multi = computeSccPartition(csr, SCC_ENGINE_PARALLEL, 4);
+        if (!sameComponents(reference, single, g.size) || !samePartitions(single, multi)) result = 1;
+        // Classes numérotées selon leur plus petit sommet, sommets croissants
+        int previous = 0;
+        for (int id = 1; id <= (multi != NULL ? multi->class_number : 0) && result == 0; id++) {
+            t_class *c = multi->classes;
+            while (c != NULL && c->id != id) c = c->next;
+            if (c == NULL || c->vertices->value <= previous) result = 1;
+            for (t_vertex *v = c != NULL ? c->vertices : NULL; v != NULL && v->next != NULL; v = v->next)
+                if (v->next->value <= v->value) result = 1;
+            if (c != NULL) previous = c->vertices->value;
+        }
+        freePartition(reference);
+        freePartition(single);
+        freePartition(multi);
+        freeCsrGraph(&csr);
+        freeGraph(&g);
+    }
+    return result;
+}
+
+// Test moteur parallèle sur des chaînes d'un million d'états
+static int test_scc_parallel_long_chain(void) {
+    const int size = 1000000;
+    t_graph g = createArenaGraph(size);
+    for (int v = 1; v <= size; v++) {
+        addEdge(&g, v, v < size ? v + 1 : v, 0.5);
+        addEdge(&g, v, v > 1 ? v - 1 : v, 0.5);
+    }
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_partition *p = parallelScc(csr, 4);
+    int result = (p != NULL && p->class_number == 1 && p->classes->vertex_number == size) ? 0 : 1;
+    freePartition(p);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+
+    // Chaîne sans retour : entièrement éliminée par le trim
+    g = createArenaGraph(size);
+    for (int v = 1; v < size; v++) addEdge(&g, v, v + 1, 1.0);
+    csr = createCsrGraphFromGraph(g);
+    p = parallelScc(csr, 4);
+    if (p == NULL || p->class_number != size || p->classes->vertex_number != 1) result = 1;
+    freePartition(p);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Vérifie que deux DAG de condensation du même graphe ont les mêmes liens, quels que soient les ids
+static int sameCondensationDags(t_condensation_dag a, t_association_array assoc_a,
+                                t_condensation_dag b, t_association_array assoc_b, int size) {
+    if (isEmptyCondensationDag(a) || isEmptyCondensationDag(b) ||
+        a.class_count != b.class_count || a.edge_count != b.edge_count) return 0;
+    int *match = calloc((size_t)a.class_count + 1, sizeof(int));
+    if (match == NULL) return 0;
+    for (int v = 0; v < size; v++) match[assoc_a[v]] = assoc_b[v];
+    int result = 1;
+    for (int c = 1; c <= a.class_count && result; c++) {
+        for (int e = a.offsets[c]; e < a.offsets[c + 1] && result; e++) {
+            int found = 0;
+            int src = match[c], dest = match[a.targets[e]];
+            for (int f = b.offsets[src]; f < b.offsets[src + 1]; f++) found |= (b.targets[f] == dest);
+            result = found;
+        }
+    }
+    free(match);
+    return result;
+}
+
+// Test choix du moteur dans le diagramme de Hasse : mêmes liens et mêmes classes persistantes
+static int test_hasse_scc_engine(void) {
+    t_graph g = createRandomSccGraph(5000, 3u);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_hasse_diagram h1 = createHasseDiagramFromCsrWithEngine(csr, SCC_ENGINE_TARJAN, 0);
+    t_hasse_diagram h2 = createHasseDiagramFromCsrWithEngine(csr, SCC_ENGINE_PARALLEL, 4);
+    int result = (h1.partition != NULL && h2.partition != NULL &&
+                  sameComponents(h1.partition, h2.partition, g.size)) ? 0 : 1;
+    for (int v = 0; v < g.size && result == 0; v++) {
+        if (isPersistantClass(h1, h1.association_array[v]) != isPersistantClass(h2, h2.association_array[v]))
+            result = 1;
+    }
+    // Liens avant réduction transitive : les mêmes entre classes correspondantes
+    t_condensation_dag d1 = createCondensationDagFromCsr(csr, *h1.partition, h1.association_array);
+    t_condensation_dag d2 = createCondensationDagFromCsr(csr, *h2.partition, h2.association_array);
+    if (!sameCondensationDags(d1, h1.association_array, d2, h2.association_array, g.size)) result = 1;
+    // Après réduction transitive exacte : mêmes liens de Hasse
+    if (h1.logical_size != h2.logical_size) result = 1;
+    if (reduceCondensationDag(&d2) < 0 || d2.edge_count != h2.logical_size) result = 1;
+    for (int i = 0; i < h2.logical_size && result == 0; i++)
+        if (h2.links[i].dest_id != d2.targets[i]) result = 1;
+    freeCondensationDag(&d1);
+    freeCondensationDag(&d2);
+    freeHasseDiagram(&h1);
+    freeHasseDiagram(&h2);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Test DAG de condensation : liens distincts, identiques à addLink, et pour le graphe et le CSR
+static int test_condensation_dag(void) {
+    const char *paths[] = { "../data/exemple1.txt", "../data/exemple3.txt", "../data/exemple_hasse1.txt",
+                            "../data/exemple_scc1.txt", "../data/exemple_valid_step3.txt",
+                            "../data/exemple4_2check.txt" };
+    int count = (int)(sizeof paths / sizeof paths[0]);
+    int result = 0;
+    for (int p = 0; p < count + 1 && result == 0; p++) {
+        t_graph g = p < count ? importGraphFromFile(paths[p]) : createRandomSccGraph(3000, 11u);
+        if (g.size == 0) return 1;
+        t_csr_graph csr = createCsrGraphFromGraph(g);
+        t_partition *part = tarjan(g);
+        t_association_array assoc = createAssociationArray(g, *part);
+        t_condensation_dag dag = createCondensationDag(g, *part, assoc);
+        t_condensation_dag dag_csr = createCondensationDagFromCsr(csr, *part, assoc);
+
+        // Construction d'origine : addLink pour chaque arête entre deux classes
+        t_link_array reference = { malloc(sizeof(t_link)), part, assoc, 0, 1, NULL, NULL };
+        for (int i = 0; i < g.size; i++)
+            for (t_cell *cur = g.values[i].head; cur != NULL; cur = cur->next)
+                if (assoc[i] != assoc[cur->vertex - 1]) addLink(&reference, assoc[i], assoc[cur->vertex - 1]);
+
+        if (isEmptyCondensationDag(dag) || dag.class_count != part->class_number ||
+            dag.edge_count != reference.logical_size ||
+            memcmp(dag.offsets, dag_csr.offsets, (size_t)(dag.class_count + 2) * sizeof(int)) != 0 ||
+            memcmp(dag.targets, dag_csr.targets, (size_t)dag.edge_count * sizeof(int)) != 0) result = 1;
+        for (int c = 1; c <= dag.class_count && result == 0; c++)
+            for (int e = dag.offsets[c]; e < dag.offsets[c + 1]; e++)
+                if (!linkExists(reference, c, dag.targets[e])) result = 1;
+
+        free(reference.links);
+        freeCondensationDag(&dag);
+        freeCondensationDag(&dag_csr);
+        free(assoc);
+        freePartition(part);
+        freeCsrGraph(&csr);
+        freeGraph(&g);
+    }
+    return result;
+}
+
+// Vérifie si dest est atteignable depuis src dans un DAG de condensation, sans utiliser le lien d'indice skip
+static int dagReaches(t_condensation_dag dag, int src, int dest, int skip) {
+    int *stack = malloc((size_t)dag.class_count * sizeof(int));
+    char *seen = calloc((size_t)dag.class_count + 1, 1);
+    int top = 0, found = 0;
+    stack[top++] = src;
+    seen[src] = 1;
+    while (top > 0 && !found) {
+        int c = stack[--top];
+        for (int e = dag.offsets[c]; e < dag.offsets[c + 1]; e++) {
+            int d = dag.targets[e];
+            if (e == skip || seen[d]) continue;
+            if (d == dest) found = 1;
+            seen[d] = 1;
+            stack[top++] = d;
+        }
+    }
+    free(stack);
+    free(seen);
+    return found;
+}
+
+// Test réduction transitive exacte : chemins de toute longueur, même accessibilité, liens minimaux
+static int test_reduce_condensation_dag(void) {
+    // 1 -> 2 -> 3 -> 4 et 1 -> 4 : le raccourci n'est impliqué que par un chemin de trois liens
+    t_graph g = createGraph(4);
+    addEdge(&g, 1, 2, 0.5);
+    addEdge(&g, 1, 4, 0.5);
+    addEdge(&g, 2, 3, 1.0);
+    addEdge(&g, 3, 4, 1.0);
+    addEdge(&g, 4, 4, 1.0);
+    t_hasse_diagram hasse = createHasseDiagram(g);
+    t_link_array old = { malloc(4 * sizeof(t_link)), hasse.partition, hasse.association_array, 0, 4, NULL, NULL };
+    int a = hasse.association_array[0], b = hasse.association_array[1];
+    int c = hasse.association_array[2], d = hasse.association_array[3];
+    addLink(&old, a, b);
+    addLink(&old, a, d);
+    addLink(&old, b, c);
+    addLink(&old, c, d);
+    removeTransitiveLinks(&old);
+    int result = (hasse.logical_size == 3 && !linkExists(hasse, a, d) && old.logical_size == 4) ? 0 : 1;
+    free(old.links);
+    freeHasseDiagram(&hasse);
+    freeGraph(&g);
+
+    // DAG aléatoire de 300 classes (plusieurs mots de 64 bits par ensemble)
+    const int size = 300;
+    unsigned int state = 5u;
+    g = createArenaGraph(size);
+    for (int v = 1; v <= size; v++) {
+        for (int k = 0; k < 4 && v < size; k++) {
+            state = state * 1103515245u + 12345u;
+            int dest = v + 1 + (int)((state >> 16) % 40);
+            addEdge(&g, v, dest <= size ? dest : size, 0.25);
+        }
+        if (v == size) addEdge(&g, v, v, 1.0);
+    }
+    t_partition *part = tarjan(g);
+    t_association_array assoc = createAssociationArray(g, *part);
+    t_condensation_dag full = createCondensationDag(g, *part, assoc);
+    t_condensation_dag reduced = createCondensationDag(g, *part, assoc);
+    int removed = reduceCondensationDag(&reduced);
+    if (removed <= 0 || reduced.edge_count + removed != full.edge_count) result = 1;
+    for (int src = 1; src <= full.class_count && result == 0; src++) {
+        for (int e = full.offsets[src]; e < full.offsets[src + 1]; e++)
+            if (!dagReaches(reduced, src, full.targets[e], -1)) result = 1;
+        for (int e = reduced.offsets[src]; e < reduced.offsets[src + 1]; e++)
+            if (dagReaches(reduced, src, reduced.targets[e], e)) result = 1;
+    }
+    freeCondensationDag(&full);
+    freeCondensationDag(&reduced);
+    free(assoc);
+    freePartition(part);
+    freeGraph(&g);
+
+    // Un graphe de classes avec un cycle est refusé
+    int offsets[] = { 0, 0, 1, 2 }, targets[] = { 2, 1 };
+    t_condensation_dag cycle = { 2, 2, malloc(sizeof offsets), malloc(sizeof targets) };
+    memcpy(cycle.offsets, offsets, sizeof offsets);
+    memcpy(cycle.targets, targets, sizeof targets);
+    if (reduceCondensationDag(&cycle) != -1 || cycle.edge_count != 2) result = 1;
+    freeCondensationDag(&cycle);
+    return result;
+}
+
+// Test degrés précalculés : mêmes réponses que le parcours des liens, états absorbants en une passe
+static int test_hasse_class_degrees(void) {
+    // 1 -> {2, 3}, 2 absorbant, 3 <-> 4 fermée, 5 sans arête sortante
+    t_graph g = createGraph(5);
+    addEdge(&g, 1, 2, 0.5);
+    addEdge(&g, 1, 3, 0.5);
+    addEdge(&g, 2, 2, 1.0);
+    addEdge(&g, 3, 4, 1.0);
+    addEdge(&g, 4, 3, 1.0);
+    t_hasse_diagram hasse = createHasseDiagram(g);
+    int result = (hasse.out_degrees != NULL && hasse.class_sizes != NULL) ? 0 : 1;
+
+    // Même diagramme sans degrés : réponses calculées en parcourant les liens
+    t_hasse_diagram scan = hasse;
+    scan.out_degrees = NULL;
+    scan.class_sizes = NULL;
+    t_class_type_array types = createClassTypeArray(hasse);
+    for (int id = 1; id <= hasse.partition->class_number && result == 0; id++) {
+        if (isPersistantClass(hasse, id) != isPersistantClass(scan, id) ||
+            isPersistantClass(hasse, id) != (types[id] == 0)) result = 1;
+    }
+    for (int s = 1; s <= g.size && result == 0; s++) {
+        if (isAbsorbingState(hasse, s, g.size) != isAbsorbingState(scan, s, g.size)) result = 1;
+    }
+    freeClassTypeArray(types);
+
+    int states[5], scanned[5];
+    int count = findAbsorbingStates(hasse, g.size, states);
+    if (count != 2 || states[0] != 2 || states[1] != 5 ||
+        findAbsorbingStates(scan, g.size, scanned) != 2 || memcmp(states, scanned, 2 * sizeof(int)) != 0) result = 1;
+    if (isPersistantClass(hasse, hasse.association_array[0]) ||
+        !isPersistantClass(hasse, hasse.association_array[2])) result = 1;
+    freeHasseDiagram(&hasse);
+    freeGraph(&g);
+    return (result == 0 && hasse.links == NULL && hasse.out_degrees == NULL) ? 0 : 1;
+}
+
+// Tests pour absorption.c
+// Ruine du joueur : états 1 et n absorbants, gain p, solution exacte connue
+static int test_absorption_gambler_ruin(void) {
+    const int n = 12;
+    const double p = 0.4, q = 0.6;
+    t_graph g = createGraph(n);
+    addEdge(&g, 1, 1, 1.0);
+    addEdge(&g, n, n, 1.0);
+    for (int v = 2; v < n; v++) {
+        addEdge(&g, v, v + 1, p);
+        addEdge(&g, v, v - 1, q);
+    }
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_hasse_diagram hasse = createHasseDiagramFromCsr(csr);
+    t_absorption a = createEmptyAbsorption();
+    int result = (computeAbsorption(csr, hasse, ABSORPTION_DEFAULT_TOLERANCE, &a) == 1 &&
+                  a.transient_count == n - 2 && a.persistent_count == 2) ? 0 : 1;
+    int top = hasse.association_array[n - 1], bottom = hasse.association_array[0];
+    double ratio = q / p, steps = n - 1;
+    for (int v = 1; v <= n && result == 0; v++) {
+        double i = v - 1;
+        double win = (1.0 - pow(ratio, i)) / (1.0 - pow(ratio, steps));
+        double duration = i / (q - p) - steps / (q - p) * win;
+        if (fabs(getAbsorptionProbability(a, v, top) - win) > 1e-9 ||
+            fabs(getAbsorptionProbability(a, v, bottom) - (1.0 - win)) > 1e-9 ||
+            fabs(a.expected_steps[v - 1] - duration) > 1e-7) result = 1;
+    }
+    displayAbsorption(a);
+    freeAbsorption(&a);
+    freeHasseDiagram(&hasse);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Cumule la masse encore transitoire après chaque pas : sa somme est le temps moyen d'absorption
+typedef struct {
+    const int *row_of_state;
+    double transient_mass;
+} t_absorption_check;
+
+static int accumulateTransientMass(int step, const double *distribution, int size, void *user_data) {
+    (void)step;
+    t_absorption_check *check = user_data;
+    for (int v = 0; v < size; v++)
+        if (check->row_of_state[v] >= 0) check->transient_mass += distribution[v];
+    return 0;
+}
+
+// Test classes transitoires en chaîne : mêmes résultats qu'une longue propagation
+static int test_absorption_matches_propagation(void) {
+    // 10 cycles transitoires de 3 états fuyant vers les suivants, l'état absorbant 31 et la classe fermée {32, 33}
+    const int blocks = 10, size = 3 * blocks + 3, absorbing = size - 2;
+    t_graph g = createGraph(size);
+    for (int b = 0; b < blocks; b++) {
+        for (int k = 0; k < 3; k++) {
+            int v = 3 * b + k + 1;
+            int next = (b + 1 < blocks) ? 3 * (b + 1) + (v * 7 + k) % 3 + 1 : absorbing + (v % 2);
+            int jump = (b + 2 < blocks) ? 3 * (b + 2) + 1 : absorbing;
+            addEdge(&g, v, 3 * b + (k + 1) % 3 + 1, 0.6);
+            addEdge(&g, v, v, 0.1);
+            addEdge(&g, v, next, 0.2);
+            addEdge(&g, v, (k == 0) ? jump : size, 0.1);
+        }
+    }
+    addEdge(&g, absorbing, absorbing, 1.0);
+    addEdge(&g, size - 1, size, 1.0);
+    addEdge(&g, size, size - 1, 1.0);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_hasse_diagram hasse = createHasseDiagramFromCsr(csr);
+    t_absorption a = createEmptyAbsorption();
+    int result = (computeAbsorption(csr, hasse, ABSORPTION_DEFAULT_TOLERANCE, &a) == 1 &&
+                  a.transient_count == 3 * blocks && a.persistent_count == 2) ? 0 : 1;
+
+    double *distribution = malloc((size_t)size * sizeof(double));
+    for (int start = 1; start <= 3 * blocks && result == 0; start++) {
+        memset(distribution, 0, (size_t)size * sizeof(double));
+        distribution[start - 1] = 1.0;
+        t_absorption_check check = { a.row_of_state, 1.0 };
+        propagateDistributionOnCsrGraph(csr, distribution, 2000, accumulateTransientMass, &check);
+        for (int r = 0; r < a.persistent_count; r++) {
+            int id = a.persistent_ids[r];
+            double mass = 0.0;
+            for (int v = 0; v < size; v++)
+                if (hasse.association_array[v] == id) mass += distribution[v];
+            if (fabs(getAbsorptionProbability(a, start, id) - mass) > 1e-9) result = 1;
+        }
+        if (fabs(a.expected_steps[start - 1] - check.transient_mass) > 1e-7) result = 1;
+    }
+    free(distribution);
+    freeAbsorption(&a);
+    freeHasseDiagram(&hasse);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Tests pour hitting.c
+// Chaîne irréductible sans arêtes en double : un cycle et deux cordes par état
+static t_graph createRandomIrreducibleChain(int size, unsigned int seed) {
+    t_graph g = createArenaGraph(size);
+    unsigned int state = seed;
+    for (int v = 1; v <= size; v++) {
+        int a, b;
+        do {
+            state = state * 1103515245u + 12345u;
+            a = 1 + (int)((state >> 16) % (unsigned int)size);
+            state = state * 1103515245u + 12345u;
+            b = 1 + (int)((state >> 16) % (unsigned int)size);
+        } while (a == b || a == v % size + 1 || b == v % size + 1);
+        addEdge(&g, v, v % size + 1, 0.5);
+        addEdge(&g, v, a, 0.3);
+        addEdge(&g, v, b, 0.2);
+    }
+    return g;
+}
+
+// Test temps d'atteinte : petit exemple calculé à la main et raccourcis par les classes
+static int test_hitting_times_classes(void) {
+    // 1 <-> 2 transitoire, 2 -> 3 absorbant ; 4 -> {1, 5}, {5, 6} fermée
+    t_graph g = createGraph(6);
+    addEdge(&g, 1, 2, 1.0);
+    addEdge(&g, 2, 1, 0.5);
+    addEdge(&g, 2, 3, 0.5);
+    addEdge(&g, 3, 3, 1.0);
+    addEdge(&g, 4, 1, 0.5);
+    addEdge(&g, 4, 5, 0.5);
+    addEdge(&g, 5, 6, 1.0);
+    addEdge(&g, 6, 5, 1.0);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_partition *part = tarjanCsr(csr);
+    t_hitting_context ctx;
+    int result = (createHittingContext(csr, part, &ctx) == 1) ? 0 : 1;
+    double times[6];
+    int to_three = 3, to_one = 1;
+    if (result == 0 && computeHittingTimes(&ctx, &to_three, 1, HITTING_DEFAULT_TOLERANCE, times) == 1) {
+        // h2 = 1 + h1 / 2, h1 = 1 + h2 : h1 = 4, h2 = 3 ; 4 peut partir vers {5, 6}
+        if (fabs(times[0] - 4.0) > 1e-9 || fabs(times[1] - 3.0) > 1e-9 || times[2] != 0.0 ||
+            !isinf(times[3]) || !isinf(times[4]) || !isinf(times[5])) result = 1;
+    } else {
+        result = 1;
+    }
+    if (result == 0 && computeHittingTimes(&ctx, &to_one, 1, HITTING_DEFAULT_TOLERANCE, times) == 1) {
+        if (times[0] != 0.0 || !isinf(times[1]) || !isinf(times[2]) || !isinf(times[3])) result = 1;
+    } else {
+        result = 1;
+    }
+    // Temps de retour : 1 -> 2 puis retour en 1 avec probabilité 1/2 seulement
+    if (!isinf(meanFirstPassageTime(&ctx, 1, 1)) || fabs(meanFirstPassageTime(&ctx, 5, 5) - 2.0) > 1e-12) result = 1;
+    freeHittingContext(&ctx);
+    freePartition(part);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Test temps d'atteinte sur une chaîne irréductible : équations vérifiées, retour en 1 / pi, lots
+static int test_hitting_times_irreducible(void) {
+    const int size = 200, sets = 12;
+    t_graph g = createRandomIrreducibleChain(size, 21u);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_partition *part = tarjanCsr(csr);
+    t_hitting_context ctx;
+    int result = (part != NULL && part->class_number == 1 && createHittingContext(csr, part, &ctx) == 1) ? 0 : 1;
+    if (result != 0) return 1;
+
+    // Ensembles de 1 à 12 cibles
+    int *targets[12], counts[12];
+    double *single[12], *batch1[12], *batch4[12];
+    for (int k = 0; k < sets; k++) {
+        counts[k] = k + 1;
+        targets[k] = malloc((size_t)counts[k] * sizeof(int));
+        for (int t = 0; t < counts[k]; t++) targets[k][t] = 1 + (k * 37 + t * 53) % size;
+        single[k] = malloc((size_t)size * sizeof(double));
+        batch1[k] = malloc((size_t)size * sizeof(double));
+        batch4[k] = malloc((size_t)size * sizeof(double));
+        if (computeHittingTimes(&ctx, targets[k], counts[k], HITTING_DEFAULT_TOLERANCE, single[k]) != 1) result = 1;
+    }
+    if (computeHittingTimesBatch(&ctx, (const int *const *)targets, counts, sets, HITTING_DEFAULT_TOLERANCE, 1, batch1) != 1 ||
+        computeHittingTimesBatch(&ctx, (const int *const *)targets, counts, sets, HITTING_DEFAULT_TOLERANCE, 4, batch4) != 1)
+        result = 1;
+    for (int k = 0; k < sets && result == 0; k++) {
+        if (memcmp(single[k], batch1[k], (size_t)size * sizeof(double)) != 0 ||
+            memcmp(single[k], batch4[k], (size_t)size * sizeof(double)) != 0) result = 1;
+        // h_i = 1 + somme des P_ij h_j hors cibles
+        for (int i = 0; i < size && result == 0; i++) {
+            if (single[k][i] == 0.0) continue;
+            double expected = 1.0;
+            for (int e = csr.offsets[i]; e < csr.offsets[i + 1]; e++) expected += csr.weights[e] * single[k][csr.targets[e] - 1];
+            if (!isfinite(single[k][i]) || fabs(expected - single[k][i]) > 1e-8 * expected) result = 1;
+        }
+    }
+
+    // Kac : temps de retour moyen = 1 / pi_i
+    t_sparse_matrix P;
+    double *pi = malloc((size_t)size * sizeof(double));
+    if (createSparseMatrixFromCsrGraph(csr, &P) == 1 &&
+        solveStationaryDistribution(P, STATIONARY_SOLVER_GTH, STATIONARY_DEFAULT_TOLERANCE, pi) == 1) {
+        for (int v = 1; v <= size && result == 0; v += 17) {
+            if (fabs(meanFirstPassageTime(&ctx, v, v) * pi[v - 1] - 1.0) > 1e-8) result = 1;
+        }
+        freeSparseMatrix(&P);
+    } else {
+        result = 1;
+    }
+    free(pi);
+    for (int k = 0; k < sets; k++) {
+        free(targets[k]);
+        free(single[k]);
+        free(batch1[k]);
+        free(batch4[k]);
+    }
+    freeHittingContext(&ctx);
+    freePartition(part);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Période de la classe d'un état, -1 si l'état n'a pas de classe
+static int periodOfState(t_hasse_diagram hasse, int state) {
+    for (t_class *c = hasse.partition->classes; c != NULL; c = c->next) {
+        if (c->id == hasse.association_array[state - 1]) return c->period;
+    }
+    return -1;
+}
+
+// Test périodes : cycle de 3, classe transitoire de période 2, boucles, état seul sans boucle
+static int test_class_periods(void) {
+    t_graph g = createArenaGraph(9);
+    addEdge(&g, 1, 2, 1.0);
+    addEdge(&g, 2, 3, 1.0);
+    addEdge(&g, 3, 1, 1.0);
+    addEdge(&g, 4, 5, 0.5);
+    addEdge(&g, 4, 1, 0.5);
+    addEdge(&g, 5, 4, 1.0);
+    addEdge(&g, 6, 6, 0.5);
+    addEdge(&g, 6, 4, 0.5);
+    addEdge(&g, 7, 1, 1.0);
+    addEdge(&g, 8, 9, 0.5);
+    addEdge(&g, 8, 8, 0.5);
+    addEdge(&g, 9, 8, 1.0);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    const int expected[9] = { 3, 3, 3, 2, 2, 1, 0, 1, 1 };
+    int result = 0;
+
+    t_hasse_diagram hasse = createHasseDiagram(g);
+    for (int v = 1; v <= 9; v++) if (periodOfState(hasse, v) != expected[v - 1]) result = 1;
+    freeHasseDiagram(&hasse);
+    const t_scc_engine engines[2] = { SCC_ENGINE_TARJAN, SCC_ENGINE_PARALLEL };
+    for (int k = 0; k < 2; k++) {
+        hasse = createHasseDiagramFromCsrWithEngine(csr, engines[k], 2);
+        for (int v = 1; v <= 9; v++) if (periodOfState(hasse, v) != expected[v - 1]) result = 1;
+        freeHasseDiagram(&hasse);
+    }
+    if (computeClassPeriods(csr, NULL, NULL) != -1) result = 1;
+
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Test période d'une matrice et choix de l'itération : POWER seulement si apériodique
+static int test_stationary_period_method(void) {
+    t_graph cycle = createArenaGraph(4), loop = createArenaGraph(3);
+    for (int v = 1; v <= 4; v++) addEdge(&cycle, v, v % 4 + 1, 1.0);
+    addEdge(&loop, 1, 2, 1.0);
+    addEdge(&loop, 2, 3, 1.0);
+    addEdge(&loop, 3, 1, 0.5);
+    addEdge(&loop, 3, 3, 0.5);
+    t_sparse_matrix sc, sl;
+    if (createSparseMatrixFromGraph(cycle, &sc) < 0) { freeGraph(&cycle); freeGraph(&loop); return 1; }
+    if (createSparseMatrixFromGraph(loop, &sl) < 0) {
+        freeSparseMatrix(&sc);
+        freeGraph(&cycle);
+        freeGraph(&loop);
+        return 1;
+    }
+    int result = (computeStationaryPeriod(sc) == 4 && computeStationaryPeriod(sl) == 1 &&
+                  chooseStationaryMethod(1) == STATIONARY_POWER && chooseStationaryMethod(4) == STATIONARY_LAZY &&
+                  chooseStationaryMethod(0) == STATIONARY_LAZY) ? 0 : 1;
+
+    // Solveur itératif : période fournie, calculée, ou fausse (1 sur un cycle : repli sur LAZY)
+    double pi[4];
+    const int periods[3] = { 4, 0, 1 };
+    for (int k = 0; k < 3; k++) {
+        if (solveStationaryDistributionWithPeriod(sc, STATIONARY_SOLVER_ITERATIVE, periods[k], 1e-12, pi) != 1) result = 1;
+        for (int j = 0; j < 4; j++) if (fabs(pi[j] - 0.25) > 1e-9) result = 1;
+    }
+    if (solveStationaryDistribution(sl, STATIONARY_SOLVER_ITERATIVE, 1e-12, pi) != 1 ||
+        fabs(pi[0] - 0.25) > 1e-9 || fabs(pi[2] - 0.5) > 1e-9) result = 1;
+
+    // M^n d'un cycle ne converge jamais : détecté sans itérer
+    t_matrix m, limit;
+    if (createMatrixFromGraph(cycle, &m) < 0) {
+        result = 1;
+    } else {
+        if (computeConvergedMatrixPower(m, 0.01, &limit, 1 << 30) != -1) result = 1;
+        freeMatrix(&m);
+    }
+    if (createMatrixFromGraph(loop, &m) < 0) {
+        result = 1;
+    } else {
+        if (computeConvergedMatrixPower(m, 1e-6, &limit, 10000) > 0) freeMatrix(&limit);
+        else result = 1;
+        freeMatrix(&m);
+    }
+
+    freeSparseMatrix(&sc);
+    freeSparseMatrix(&sl);
+    freeGraph(&cycle);
+    freeGraph(&loop);
+    return result;
+}
+
+// Test tables d'alias : une grille de u uniformes donne exactement les probabilités des arêtes
+static int test_walk_sampler_alias(void) {
+    t_graph g = createArenaGraph(6);
+    addEdge(&g, 1, 2, 0.5);
+    addEdge(&g, 1, 3, 0.25);
+    addEdge(&g, 1, 4, 0.0);
+    addEdge(&g, 1, 5, 0.125);
+    addEdge(&g, 1, 3, 0.125);
+    addEdge(&g, 2, 1, 3.0);
+    addEdge(&g, 2, 6, 1.0);
+    for (int v = 3; v <= 5; v++) addEdge(&g, v, v, 1.0);
+    t_csr_graph csr = createCsrGraphFromGraph(g);
+    t_walk_sampler sampler, csr_sampler;
+    if (createWalkSampler(g, &sampler) != 1) { freeCsrGraph(&csr); freeGraph(&g); return 1; }
+    int result = (createWalkSamplerFromCsr(csr, &csr_sampler) == 1) ? 0 : 1;
+
+    const int grid = 1 << 16;
+    const double expected_1[7] = { 0, 0, 0.5, 0.375, 0, 0.125, 0 };
+    const double expected_2[7] = { 0, 0.75, 0, 0, 0, 0, 0.25 };
+    int counts_1[7] = { 0 }, counts_2[7] = { 0 };
+    for (int i = 0; i < grid && result == 0; i++) {
+        double u = (i + 0.5) / grid;
+        int a = sampleWalkStep(&sampler, 1, u), b = sampleWalkStep(&sampler, 2, u);
+        if (a != sampleWalkStep(&csr_sampler, 1, u) || b != sampleWalkStep(&csr_sampler, 2, u)) result = 1;
+        counts_1[a]++;
+        counts_2[b]++;
+    }
+    for (int v = 1; v <= 6; v++) {
+        if (fabs((double)counts_1[v] / grid - expected_1[v]) > 1e-4) result = 1;
+        if (fabs((double)counts_2[v] / grid - expected_2[v]) > 1e-4) result = 1;
+    }
+    // État 6 sans arête : le marcheur reste sur place
+    if (sampleWalkStep(&sampler, 6, 0.3) != 6 || sampleWalkStep(&sampler, 4, 0.999) != 4) result = 1;
+
+    addEdge(&g, 6, 1, -1.0);
+    t_walk_sampler invalid;
+    if (createWalkSampler(g, &invalid) != -1) { result = 1; freeWalkSampler(&invalid); }
+
+    freeWalkSampler(&sampler);
+    freeWalkSampler(&csr_sampler);
+    freeCsrGraph(&csr);
+    freeGraph(&g);
+    return result;
+}
+
+// Test simulation : histogramme final proche de la propagation exacte, reproductible avec la même graine
+static int test_simulation_matches_propagation(void) {
+    const int steps = 10;
+    const long long walkers = 200000;
+    t_graph g = importGraphFromFile("../data/exemple1.txt");
+    t_walk_sampler sampler;
+    if (g.size == 0 || createWalkSampler(g, &sampler) != 1) { freeGraph(&g); return 1; }
+    double *distribution = calloc((size_t)g.size, sizeof(double));
+    t_simulation first = createEmptySimulation(), second = createEmptySimulation();
+    int result = (distribution != NULL &&
+                  simulateRandomWalks(&sampler, 1, walkers, steps, 42, &first) == 1 &&
+                  simulateRandomWalks(&sampler, 1, walkers, steps, 42, &second) == 1) ? 0 : 1;
+    if (result == 0) {
+        distribution[0] = 1.0;
+        if (propagateDistributionOnGraph(g, distribution, steps, NULL, NULL) != steps) result = 1;
+        double occupancy = 0.0;
+        for (int v = 1; v <= g.size && result == 0; v++) {
+            // Écart toléré : 5 écarts-types de la fréquence empirique
+            double p = distribution[v - 1], sigma = sqrt(p * (1.0 - p) / (double)walkers);
+            if (fabs(getSimulatedDistribution(first, v) - p) > 5.0 * sigma + 1e-9) result = 1;
+            if (first.final_counts[v - 1] != second.final_counts[v - 1] ||
+                first.occupancy[v - 1] != second.occupancy[v - 1]) result = 1;
+            occupancy += getSimulatedOccupancy(first, v);
+        }
+        if (fabs(occupancy - 1.0) > 1e-9) result = 1;
+    }
+    if (simulateRandomWalks(&sampler, 0, walkers, steps, 42, &second) != -1) result = 1;
+
+    free(distribution);
+    freeSimulation(&first);
+    freeSimulation(&second);
+    freeWalkSampler(&sampler);
+    freeGraph(&g);
+    return result;
+}
+
+// Test Philox4x32-10 : vecteurs de référence de Random123
+static int test_philox_known_answers(void) {
+    const uint32_t zero_counter[4] = { 0, 0, 0, 0 }, zero_key[2] = { 0, 0 };
+    const uint32_t ones_counter[4] = { 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu };
+    const uint32_t ones_key[2] = { 0xffffffffu, 0xffffffffu };
+    const uint32_t pi_counter[4] = { 0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u };
+    const uint32_t pi_key[2] = { 0xa4093822u, 0x299f31d0u };
+    const uint32_t expected[3][4] = {
+        { 0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u },
+        { 0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu },
+        { 0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u }
+    };
+    uint32_t out[3][4];
+    philox4x32(zero_counter, zero_key, out[0]);
+    philox4x32(ones_counter, ones_key, out[1]);
+    philox4x32(pi_counter, pi_key, out[2]);
+    return memcmp(out, expected, sizeof out) == 0 ? 0 : 1;
+}
+
+// Test simulation parallèle : histogrammes identiques au bit près quel que soit le nombre de threads
+static int test_simulation_thread_invariance(void) {
+    const int steps = 25;
+    const long long walkers = 20011;
+    t_graph g = importGraphFromFile("../data/exemple4_2check.txt");
+    t_walk_sampler sampler;
+    if (g.size == 0 || createWalkSampler(g, &sampler) != 1) { freeGraph(&g); return 1; }
+    t_simulation reference = createEmptySimulation(), parallel = createEmptySimulation();
+    int result = simulateRandomWalks(&sampler, 2, walkers, steps, 2024, &reference) == 1 ? 0 : 1;
+    const int threads[4] = { 1, 2, 3, 7 };
+    for (int k = 0; k < 4 && result == 0; k++) {
+        if (simulateRandomWalksParallel(&sampler, 2, walkers, steps, 2024, threads[k], &parallel) != 1) {
+            result = 1;
+            break;
+        }
+        if (memcmp(parallel.occupancy, reference.occupancy, (size_t)g.size * sizeof(long long)) != 0 ||
+            memcmp(parallel.final_counts, reference.final_counts, (size_t)g.size * sizeof(long long)) != 0) {
+            result = 1;
+        }
+        freeSimulation(&parallel);
+    }
+    // Une autre graine donne d'autres trajectoires ; plus de threads que de marcheurs reste valide
+    if (result == 0 && simulateRandomWalksParallel(&sampler, 2, walkers, steps, 2025, 2, &parallel) == 1) {
+        if (memcmp(parallel.occupancy, reference.occupancy, (size_t)g.size * sizeof(long long)) == 0) result = 1;
+        freeSimulation(&parallel);
+    } else {
+        result = 1;
+    }
+    if (simulateRandomWalksParallel(&sampler, 2, 3, steps, 2024, 8, &parallel) != 1 ||
+        parallel.walkers != 3) result = 1;
+    freeSimulation(&parallel);
+    // Au-delà de getMaxSimulationWalkers(), walkers x steps déborderait des compteurs
+    if (simulateRandomWalksParallel(&sampler, 2, getMaxSimulationWalkers(steps) + 1, steps, 2024, 8, &parallel) != -1) {
+        result = 1;
+    }
+
+    freeSimulation(&reference);
+    freeWalkSampler(&sampler);
+    freeGraph(&g);
+    return result;
+}
+
 void register_project_tests(void){
     // Tests des listes
     add_test("list_create_empty", test_list_create_empty, "Création d'une liste vide");
@@ -581,10 +2301,18 @@ void register_project_tests(void){
     add_test("graph_get_neighbors", test_graph_get_neighbors, "Récupération des voisins");
     add_test("graph_invalid_vertex", test_graph_invalid_vertex, "Gestion sommet invalide");
     add_test("graph_free", test_graph_free, "Libération d'un graphe");
+    add_test("graph_arena_edges", test_graph_arena_edges, "Ajout d'arêtes dans un graphe à arène");
+    add_test("graph_arena_free", test_graph_arena_free, "Libération d'un graphe à arène");
+    add_test("graph_same", test_graph_same, "Comparaison de deux graphes arête par arête");
 
     // Tests de lecture de fichier
     add_test("read_file_valid", test_read_file_valid, "Lecture d'un fichier valide");
     add_test("read_file_nonexistent", test_read_file_nonexistent, "Lecture fichier inexistant");
+    add_test("read_file_matches_scanf", test_read_file_matches_scanf, "Tokenizer identique à fscanf");
+    add_test("read_file_number_formats", test_read_file_number_formats, "Tokenizer sur formats numériques variés");
+    add_test("read_mapped_file", test_read_mapped_file, "Import par projection mémoire");
+    add_test("read_mapped_fifo", test_read_mapped_fifo, "Import d'une FIFO sans la rouvrir");
+    add_test("read_mapped_file_invalid", test_read_mapped_file_invalid, "Projection d'un fichier inexistant ou vide");
 
     // Tests Markov
     add_test("markov_valid", test_markov_valid, "Graphe de Markov valide");
@@ -630,4 +2358,74 @@ void register_project_tests(void){
     add_test("tarjan_empty_graph", test_tarjan_empty_graph, "Tarjan sur graphe vide");
     add_test("tarjan_single_vertex_no_edges", test_tarjan_single_vertex_no_edges, "Tarjan sur sommet isolé");
     add_test("tarjan_imported_graph_example3", test_tarjan_imported_graph_example3, "Tarjan sur data/example3.txt");
+    add_test("tarjan_iterative_same_partition", test_tarjan_iterative_same_partition, "Tarjan itératif identique au récursif");
+    add_test("tarjan_iterative_long_chain", test_tarjan_iterative_long_chain, "Tarjan itératif sur une chaîne d'un million d'états");
+
+    // Tests csr_graph.c
+    add_test("csr_from_graph", test_csr_from_graph, "Conversion d'un graphe en CSR");
+    add_test("csr_import_matches_graph", test_csr_import_matches_graph, "Import CSR identique à importGraphFromFile");
+    add_test("csr_import_nonexistent", test_csr_import_nonexistent, "Import CSR d'un fichier inexistant");
+    add_test("csr_transpose", test_csr_transpose, "Graphe CSR inverse");
+    add_test("tarjan_csr_same_partition", test_tarjan_csr_same_partition, "Tarjan CSR identique à Tarjan");
+    add_test("matrix_from_csr_graph", test_matrix_from_csr_graph, "Matrice depuis un graphe CSR");
+
+    // Tests graph_loader.c
+    add_test("read_file_parallel", test_read_file_parallel, "Import parallèle identique à l'import séquentiel");
+    add_test("read_file_parallel_fallback", test_read_file_parallel_fallback, "Import parallèle d'un fichier mal formé");
+
+    // Tests graph_binary.c
+    add_test("binary_round_trip", test_binary_round_trip, "Sauvegarde puis chargement binaire");
+    add_test("binary_convert", test_binary_convert, "Conversion texte vers binaire et chargement CSR");
+    add_test("binary_invalid", test_binary_invalid, "Chargement binaire d'un fichier invalide ou tronqué");
+
+    // Tests matrix.c
+    add_test("matrix_contiguous_storage", test_matrix_contiguous_storage, "Stockage contigu et aligné des matrices");
+    add_test("matrix_set_data_multiply", test_matrix_set_data_multiply, "Remplissage, copie et produit de matrices");
+    add_test("matrix_multiply_kernels", test_matrix_multiply_kernels, "Produit par blocs identique pour chaque noyau");
+    add_test("matrix_power_squaring", test_matrix_power_squaring, "Puissance par exponentiation rapide");
+    add_test("matrix_multiply_into", test_matrix_multiply_into, "Produit dans une matrice déjà allouée");
+    add_test("matrix_converged_power", test_matrix_converged_power, "Puissance convergée incrémentale et par doublement");
+
+    // Tests propagation.c
+    add_test("propagation_matches_matrix", test_propagation_matches_matrix, "Propagation sur graphe et CSR identique au calcul matriciel");
+    add_test("propagation_duplicate_edges", test_propagation_duplicate_edges, "Arêtes en double additionnées par tous les moteurs");
+    add_test("propagation_time_series", test_propagation_time_series, "Série temporelle des distributions");
+
+    // Tests sparse_matrix.c
+    add_test("sparse_matrix_from_graph", test_sparse_matrix_from_graph, "Matrice creuse identique à la matrice dense");
+    add_test("sparse_matrix_products", test_sparse_matrix_products, "Produits creux-vecteur, creux-dense et creux-creux");
+    add_test("sparse_matrix_submatrix_distribution", test_sparse_matrix_submatrix_distribution, "Sous-matrice et distribution creuses");
+
+    // Tests stationary.c
+    add_test("stationary_matches_converged_power", test_stationary_matches_converged_power, "Distribution stationnaire identique à la limite de M^n");
+    add_test("stationary_periodic_class", test_stationary_periodic_class, "Distribution stationnaire d'une classe périodique");
+    add_test("stationary_period_method", test_stationary_period_method, "Période d'une classe et choix de l'itération");
+    add_test("stationary_direct_solvers", test_stationary_direct_solvers, "Distribution stationnaire par élimination GTH et LU");
+    add_test("stationary_solver_dispatch", test_stationary_solver_dispatch, "Choix entre solveur direct et itératif");
+    add_test("stationary_parallel_classes", test_stationary_parallel_classes, "Distributions stationnaires calculées en parallèle");
+
+    // Tests scc.c
+    add_test("scc_parallel_same_components", test_scc_parallel_same_components, "Moteur SCC parallèle identique à Tarjan");
+    add_test("scc_parallel_long_chain", test_scc_parallel_long_chain, "Moteur SCC parallèle sur une chaîne d'un million d'états");
+    add_test("hasse_scc_engine", test_hasse_scc_engine, "Diagramme de Hasse avec chaque moteur SCC");
+
+    // Tests hasse.c
+    add_test("condensation_dag", test_condensation_dag, "DAG de condensation sans doublons, graphe et CSR");
+    add_test("reduce_condensation_dag", test_reduce_condensation_dag, "Réduction transitive exacte du DAG de condensation");
+    add_test("hasse_class_degrees", test_hasse_class_degrees, "Classes persistantes et états absorbants en O(1)");
+    add_test("class_periods", test_class_periods, "Période de chaque classe par niveaux BFS");
+
+    // Tests absorption.c
+    add_test("absorption_gambler_ruin", test_absorption_gambler_ruin, "Probabilités et temps d'absorption de la ruine du joueur");
+    add_test("absorption_matches_propagation", test_absorption_matches_propagation, "Absorption identique à une longue propagation");
+
+    // Tests hitting.c
+    add_test("hitting_times_classes", test_hitting_times_classes, "Temps d'atteinte et états qui peuvent manquer les cibles");
+    add_test("hitting_times_irreducible", test_hitting_times_irreducible, "Temps d'atteinte, temps de retour et calcul par lots");
+
+    // Tests simulation.c
+    add_test("walk_sampler_alias", test_walk_sampler_alias, "Tables d'alias : probabilités exactes par état");
+    add_test("simulation_matches_propagation", test_simulation_matches_propagation, "Marches aléatoires contre propagation exacte");
+    add_test("philox_known_answers", test_philox_known_answers, "Générateur Philox4x32-10 : vecteurs de référence");
+    add_test("simulation_thread_invariance", test_simulation_thread_invariance, "Simulation identique pour 1, 2, 3 et 7 threads");
 }
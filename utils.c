@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 #include "utils.h"
 
 char *getID(int i)
@@ -100,6 +101,21 @@ int maxInt(int a, int b) {
     return (a > b) ? a : b;
 }
 
+long long minLongLong(long long a, long long b) {
+    // Retourner le plus petit des deux
+    return (a < b) ? a : b;
+}
+
+int gcdInt(int a, int b) {
+    // Algorithme d'Euclide
+    while (b != 0) {
+        int r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
 char *intToStr(int value) {
     // Buffer statique pour la conversion
     static char buffer[20];
@@ -107,6 +123,14 @@ char *intToStr(int value) {
     return buffer;
 }
 
+int resolveThreadCount(int requested) {
+    // Nombre explicite, puis valeur de compilation, puis nombre de processeurs
+    if (requested > 0) return requested;
+    if (MARKOV_DEFAULT_THREADS > 0) return MARKOV_DEFAULT_THREADS;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cpus > 0) ? (int)cpus : 1;
+}
+
 void debugPrint(int isDebugMode, const char *msg) {
     // N'afficher que si le mode debug est activé
     if (!isDebugMode) return;
@@ -6,6 +6,14 @@
 
 #define STACK_EMPTY (-1)
 
+/**
+ * @brief Default number of worker threads of the parallel algorithms.
+ * Set at build time (CMake option MARKOV_THREADS), 0 means one thread per online CPU.
+ */
+#ifndef MARKOV_DEFAULT_THREADS
+#define MARKOV_DEFAULT_THREADS 0
+#endif
+
 /**
  * @brief Stack cell structure
  */
@@ -93,6 +101,22 @@ int minInt(int, int);
  */
 int maxInt(int, int);
 
+/**
+ * @brief Returns the minimum of two long long integers
+ * @param a First integer
+ * @param b Second integer
+ * @return The smaller of the two values
+ */
+long long minLongLong(long long, long long);
+
+/**
+ * @brief Returns the greatest common divisor of two non-negative integers
+ * @param a First integer
+ * @param b Second integer
+ * @return gcd(a, b), with gcd(0, b) = b
+ */
+int gcdInt(int, int);
+
 /**
  * @brief Converts an integer to a string
  * @param value The integer to convert
@@ -101,6 +125,14 @@ int maxInt(int, int);
  */
 char *intToStr(int);
 
+/**
+ * @brief Resolves the number of worker threads to use
+ * @param requested Requested number of threads, or 0 for the build default
+ * @return requested if > 0, otherwise MARKOV_DEFAULT_THREADS if > 0,
+ *         otherwise the number of online CPUs (at least 1)
+ */
+int resolveThreadCount(int requested);
+
 /**
  * @brief Prints a debug message if debug mode is enabled
  * @param isDebugMode 1 to enable debug output, 0 to disable